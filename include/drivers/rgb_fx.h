@@ -11,6 +11,10 @@
 
 #include <zmk/rgb_fx.h>
 
+#if IS_ENABLED(CONFIG_ZMK_RGB_FX_STATS)
+#include <zmk/rgb_fx_stats.h>
+#endif
+
 /**
  * @file
  * #brief Public API for controlling RGB effects.
@@ -19,17 +23,108 @@
  * for various types of 2D effects.
  */
 
-struct rgb_fx_pixel {
-    const uint8_t position_x;
-    const uint8_t position_y;
+struct rgb_fx_pixel_position {
+    uint8_t x;
+    uint8_t y;
+};
+
+/**
+ * Frame the effects render into. The pixel geometry never changes and is kept apart from the
+ * colors, so render loops only touch the half of the pixel data they actually need.
+ */
+struct rgb_fx_frame {
+    /**
+     * Position of each pixel.
+     */
+    const struct rgb_fx_pixel_position *positions;
 
-    struct zmk_color_rgb value;
+    /**
+     * Color of each pixel, blended together by the effects.
+     */
+    struct zmk_color_rgb *colors;
+
+    size_t num_pixels;
 };
 
+/**
+ * Number of pixels of the zmk,rgb-fx node.
+ */
+#define RGB_FX_NUM_PIXELS DT_PROP_LEN(DT_INST(0, zmk_rgb_fx), pixels)
+
+/**
+ * Positions of the pixels of the zmk,rgb-fx node, in the order of the frame buffer.
+ */
+extern const struct rgb_fx_pixel_position rgb_fx_pixel_positions[RGB_FX_NUM_PIXELS];
+
+/**
+ * Defines a frame covering every pixel of the zmk,rgb-fx node, with its own color buffer.
+ */
+#define RGB_FX_FRAME_DEFINE(name, colors_name)                                                     \
+    static struct zmk_color_rgb colors_name[RGB_FX_NUM_PIXELS];                                    \
+                                                                                                   \
+    static const struct rgb_fx_frame name = {                                                      \
+        .positions = rgb_fx_pixel_positions,                                                       \
+        .colors = colors_name,                                                                     \
+        .num_pixels = RGB_FX_NUM_PIXELS,                                                           \
+    }
+
+#define RGB_FX_PIXEL_MAP_ELEM_IS_IDENTITY(node_id, prop, idx)                                      \
+    (DT_PROP_BY_IDX(node_id, prop, idx) == idx)
+
+/**
+ * True if the pixels of the effect instance are exactly 0..N-1 of the whole chain,
+ * in which case the effect can render without going through its pixel map.
+ */
+#define RGB_FX_DT_INST_PIXEL_MAP_IS_IDENTITY(inst)                                                 \
+    (DT_INST_PROP_LEN(inst, pixels) == DT_PROP_LEN(DT_INST(0, zmk_rgb_fx), pixels) &&              \
+     (DT_INST_FOREACH_PROP_ELEM_SEP(inst, pixels, RGB_FX_PIXEL_MAP_ELEM_IS_IDENTITY, (&&))))
+
+/**
+ * Pixel map of the effect instance, or NULL if it is the identity.
+ */
+#define RGB_FX_DT_INST_PIXEL_MAP(inst, pixel_map)                                                  \
+    (RGB_FX_DT_INST_PIXEL_MAP_IS_IDENTITY(inst) ? NULL : (pixel_map))
+
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+/**
+ * @brief Resolve the i-th pixel of an effect to its index in the frame.
+ *
+ * Effects write their pixel loops once against this function and call them with either their
+ * pixel map or a literal NULL. Once inlined, the NULL variant becomes a contiguous loop
+ * without the indirection.
+ *
+ * @param pixel_map Pixel map of the effect, NULL if it covers every pixel in order
+ * @param i         Index of the pixel within the effect
+ * @return          Index of the pixel within the frame
+ */
+static ALWAYS_INLINE size_t rgb_fx_pixel_index(const zmk_rgb_fx_pixel_idx_t *pixel_map, size_t i) {
+    return pixel_map == NULL ? i : pixel_map[i];
+}
+
+/**
+ * @brief Blend a span of an effect's pixels into the frame.
+ *
+ * @param blend_span Span kernel of the effect's blending mode
+ * @param frame      Frame to render into
+ * @param pixel_map  Pixel map of the effect, NULL if it covers every pixel in order
+ * @param offset     Index of the first pixel of the span within the effect
+ * @param blend      Colors to blend, one for each pixel of the span
+ * @param count      Number of pixels in the span
+ */
+static ALWAYS_INLINE void rgb_fx_blend_span(zmk_blend_span_t blend_span,
+                                            const struct rgb_fx_frame *frame,
+                                            const zmk_rgb_fx_pixel_idx_t *pixel_map, size_t offset,
+                                            const struct zmk_color_rgb *blend, size_t count) {
+    if (pixel_map == NULL) {
+        blend_span(&frame->colors[offset], NULL, blend, count);
+    } else {
+        blend_span(frame->colors, &pixel_map[offset], blend, count);
+    }
+}
+
 /**
  * @typedef rgb_fx_start
  * @brief Callback API for starting an animation.
@@ -50,15 +145,34 @@ typedef void (*rgb_fx_api_stop)(const struct device *dev);
  * @typedef animation_render_frame
  * @brief Callback API for generating the next animation frame.
  *
- * @see animation_render_frame() for argument descriptions.
+ * @see rgb_fx_render_frame() for argument descriptions.
+ */
+typedef void (*rgb_fx_api_render_frame)(const struct device *dev,
+                                        const struct rgb_fx_frame *frame, uint32_t delta_ms);
+
+/**
+ * @typedef rgb_fx_api_is_dirty
+ * @brief Optional callback API for checking whether the next frame would differ
+ *        from the last one rendered by the effect.
+ *
+ * @see rgb_fx_is_dirty() for argument descriptions.
  */
-typedef void (*rgb_fx_api_render_frame)(const struct device *dev, struct rgb_fx_pixel *pixels,
-                                        size_t num_pixels);
+typedef bool (*rgb_fx_api_is_dirty)(const struct device *dev);
+
+/**
+ * @typedef rgb_fx_api_skip_frame
+ * @brief Optional callback API for advancing an animation without drawing the frame.
+ *
+ * @see rgb_fx_skip_frame() for argument descriptions.
+ */
+typedef void (*rgb_fx_api_skip_frame)(const struct device *dev, uint32_t delta_ms);
 
 struct rgb_fx_api {
     rgb_fx_api_start on_start;
     rgb_fx_api_stop on_stop;
     rgb_fx_api_render_frame render_frame;
+    rgb_fx_api_is_dirty is_dirty;
+    rgb_fx_api_skip_frame skip_frame;
 };
 
 static inline void rgb_fx_start(const struct device *dev) {
@@ -73,11 +187,118 @@ static inline void rgb_fx_stop(const struct device *dev) {
     return api->on_stop(dev);
 }
 
-static inline void rgb_fx_render_frame(const struct device *dev, struct rgb_fx_pixel *pixels,
-                                       size_t num_pixels) {
+/**
+ * @brief Render the next frame of the effect with the given render callback.
+ *
+ * Used by rgb_fx_render_frame() and by the functions generated for
+ * CONFIG_ZMK_RGB_FX_STATIC_GRAPH, which pass the effect's callback directly.
+ *
+ * @param render_frame Render callback of the effect
+ * @param dev          Effect device
+ * @param frame        Frame to render into
+ * @param delta_ms     Time elapsed since the previous frame, in milliseconds
+ */
+static ALWAYS_INLINE void rgb_fx_render_frame_with(rgb_fx_api_render_frame render_frame,
+                                                   const struct device *dev,
+                                                   const struct rgb_fx_frame *frame,
+                                                   uint32_t delta_ms) {
+#if IS_ENABLED(CONFIG_ZMK_RGB_FX_STATS)
+    const uint32_t start = k_cycle_get_32();
+
+    render_frame(dev, frame, delta_ms);
+
+    zmk_rgb_fx_stats_record_fx(dev, k_cycle_get_32() - start);
+#else
+    render_frame(dev, frame, delta_ms);
+#endif
+}
+
+/**
+ * @brief Render the next frame of the effect.
+ *
+ * Effects advance their animations by the elapsed time rather than by a number of frames,
+ * so their speed doesn't depend on the frame rate.
+ *
+ * @param dev      Effect device
+ * @param frame    Frame to render into
+ * @param delta_ms Time elapsed since the previous frame, in milliseconds
+ */
+static inline void rgb_fx_render_frame(const struct device *dev, const struct rgb_fx_frame *frame,
+                                       uint32_t delta_ms) {
+    const struct rgb_fx_api *api = (const struct rgb_fx_api *)dev->api;
+
+    rgb_fx_render_frame_with(api->render_frame, dev, frame, delta_ms);
+}
+
+/**
+ * Name of the render function generated for an effect node with CONFIG_ZMK_RGB_FX_STATIC_GRAPH.
+ */
+#define RGB_FX_DT_RENDER_FN(node_id) UTIL_CAT(rgb_fx_render_, DT_DEP_ORD(node_id))
+
+#define RGB_FX_DT_DECLARE_RENDER(node_id)                                                          \
+    void RGB_FX_DT_RENDER_FN(node_id)(const struct rgb_fx_frame *frame, uint32_t delta_ms);
+
+#define RGB_FX_DT_DECLARE_RENDER_BY_IDX(node_id, prop, idx)                                        \
+    RGB_FX_DT_DECLARE_RENDER(DT_PHANDLE_BY_IDX(node_id, prop, idx))
+
+/**
+ * Defines the render function of an effect instance, which calls the given render callback
+ * directly. Expands to nothing unless CONFIG_ZMK_RGB_FX_STATIC_GRAPH is enabled.
+ */
+#define RGB_FX_DT_INST_DEFINE_RENDER(inst, render_fn)                                              \
+    IF_ENABLED(CONFIG_ZMK_RGB_FX_STATIC_GRAPH,                                                     \
+               (void RGB_FX_DT_RENDER_FN(DT_DRV_INST(inst))(const struct rgb_fx_frame *frame,      \
+                                                            uint32_t delta_ms) {                   \
+                   rgb_fx_render_frame_with(render_fn, DEVICE_DT_INST_GET(inst), frame, delta_ms); \
+               }))
+
+/**
+ * @brief Check whether the effect's contribution to the next frame would change.
+ *
+ * Effects which don't implement the callback are assumed to change on every frame.
+ *
+ * @param dev Effect device
+ * @return    False if rendering the next frame would produce the same output as the last one.
+ */
+static inline bool rgb_fx_is_dirty(const struct device *dev) {
+    const struct rgb_fx_api *api = (const struct rgb_fx_api *)dev->api;
+
+    if (api->is_dirty == NULL) {
+        return true;
+    }
+
+    return api->is_dirty(dev);
+}
+
+/**
+ * @brief Check whether the effect can advance its animation without drawing a frame.
+ *
+ * @param dev Effect device
+ * @return    True if rgb_fx_skip_frame() is supported by the effect.
+ */
+static inline bool rgb_fx_can_skip_frame(const struct device *dev) {
+    const struct rgb_fx_api *api = (const struct rgb_fx_api *)dev->api;
+
+    return api->skip_frame != NULL;
+}
+
+/**
+ * @brief Advance the animation of an effect whose output isn't visible in this frame.
+ *
+ * The effect updates its state exactly as if the frame was rendered, but doesn't draw anything.
+ * Effects which don't support this are left untouched.
+ *
+ * @param dev      Effect device
+ * @param delta_ms Time elapsed since the previous frame, in milliseconds
+ */
+static inline void rgb_fx_skip_frame(const struct device *dev, uint32_t delta_ms) {
     const struct rgb_fx_api *api = (const struct rgb_fx_api *)dev->api;
 
-    return api->render_frame(dev, pixels, num_pixels);
+    if (api->skip_frame == NULL) {
+        return;
+    }
+
+    api->skip_frame(dev, delta_ms);
 }
 
 #ifdef __cplusplus
@@ -0,0 +1,75 @@
+/*
+ * Copyright (c) 2024 Kuba Birecki
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+#include <zephyr/device.h>
+#include <zephyr/drivers/led_strip.h>
+#include <zephyr/kernel.h>
+
+struct zmk_led_strip_emul_frame {
+    /**
+     * Uptime when the update was made.
+     */
+    uint64_t timestamp_ns;
+
+    /**
+     * Time the transfer would take on the modeled bus.
+     */
+    uint32_t bus_ns;
+
+    size_t num_pixels;
+};
+
+struct zmk_led_strip_emul_stats {
+    uint32_t updates;
+
+    /**
+     * Updates which sent exactly the same pixels as the one before them.
+     */
+    uint32_t redundant_updates;
+
+    /**
+     * Bytes which would have been sent over the bus, including protocol overhead.
+     */
+    uint64_t bytes;
+
+    uint64_t bus_ns;
+
+    /**
+     * Uptime of the first and the last update, the bus throughput is
+     * bytes / (last_ns - first_ns).
+     */
+    uint64_t first_ns;
+    uint64_t last_ns;
+};
+
+/**
+ * Returns a recorded update, where age 0 is the most recent one.
+ *
+ * @param  dev    Emulated LED strip
+ * @param  age    Number of updates made since the requested one
+ * @param  frame  Timing of the update
+ * @param  pixels Buffer for the pixel data, at least frame->num_pixels long, may be NULL
+ * @param  size   Size of the pixel buffer
+ * @return        0 on success, -ENOENT if the update is no longer in the history,
+ *                -ENOMEM if the pixel buffer is too small
+ */
+int zmk_led_strip_emul_get_frame(const struct device *dev, size_t age,
+                                 struct zmk_led_strip_emul_frame *frame, struct led_rgb *pixels,
+                                 size_t size);
+
+void zmk_led_strip_emul_get_stats(const struct device *dev, struct zmk_led_strip_emul_stats *stats);
+
+/**
+ * Clears the history and the statistics.
+ */
+void zmk_led_strip_emul_reset(const struct device *dev);
+
+/**
+ * Returns the time it takes to send the given number of pixels on the modeled bus.
+ */
+uint32_t zmk_led_strip_emul_bus_ns(const struct device *dev, size_t num_pixels);
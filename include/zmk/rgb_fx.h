@@ -16,10 +16,66 @@
 #define ZMK_RGB_FX_BLENDING_MODE_SCREEN 4
 #define ZMK_RGB_FX_BLENDING_MODE_SUBTRACT 5
 
+/**
+ * Index into the pixels of the RGB effects chain, sized to the number of pixels so that the
+ * pixel maps of the effects take up as little space as possible.
+ */
+#if DT_PROP_LEN(DT_INST(0, zmk_rgb_fx), pixels) <= UINT8_MAX + 1
+typedef uint8_t zmk_rgb_fx_pixel_idx_t;
+#else
+typedef uint16_t zmk_rgb_fx_pixel_idx_t;
+#endif
+
+#if IS_ENABLED(CONFIG_ZMK_RGB_FX_OP_COUNT)
+/**
+ * Number of pixel operations performed so far. It isn't atomic,
+ * so it must only be updated from the context rendering the frames.
+ */
+extern uint32_t zmk_rgb_fx_op_count;
+
+#define ZMK_RGB_FX_COUNT_OPS(n) (zmk_rgb_fx_op_count += (n))
+
+/**
+ * Returns the number of pixel operations performed since boot. The difference between two
+ * readings is the cost of the work done in between, which is the same on every run.
+ */
+uint32_t zmk_rgb_fx_get_op_count(void);
+#else
+#define ZMK_RGB_FX_COUNT_OPS(n)
+#endif
+
+#if IS_ENABLED(CONFIG_ZMK_RGB_FX_COLOR_FIXED_POINT)
+
+/**
+ * Color channels and fractions (interpolation steps, intensities) are unsigned Q0.16 values,
+ * where ZMK_COLOR_MAX represents 1.0.
+ */
+typedef uint16_t zmk_color_channel_t;
+typedef uint16_t zmk_color_fraction_t;
+
+#define ZMK_COLOR_MAX UINT16_MAX
+
+/**
+ * Creates a fraction from two non-negative integers, where num <= den <= UINT16_MAX.
+ */
+#define ZMK_COLOR_FRACTION(num, den)                                                               \
+    ((zmk_color_fraction_t)(((uint32_t)(num) * UINT16_MAX) / (uint32_t)(den)))
+
+#else
+
+typedef float zmk_color_channel_t;
+typedef float zmk_color_fraction_t;
+
+#define ZMK_COLOR_MAX 1.0f
+
+#define ZMK_COLOR_FRACTION(num, den) ((float)(num) / (float)(den))
+
+#endif /* IS_ENABLED(CONFIG_ZMK_RGB_FX_COLOR_FIXED_POINT) */
+
 struct zmk_color_rgb {
-    float r;
-    float g;
-    float b;
+    zmk_color_channel_t r;
+    zmk_color_channel_t g;
+    zmk_color_channel_t b;
 };
 
 struct zmk_color_hsl {
@@ -40,6 +96,58 @@ static inline size_t zmk_rgb_fx_get_pixel_by_key_position(size_t key_position) {
 uint8_t zmk_rgb_fx_get_pixel_distance(size_t pixel_idx, size_t other_pixel_idx);
 #endif
 
+/**
+ * Creates a fraction from two durations or other values which may exceed the range of
+ * ZMK_COLOR_FRACTION(). Both values are shifted down until they fit, so num <= den is required.
+ *
+ * @param  num Numerator
+ * @param  den Denominator, must be greater than zero
+ * @return     The fraction num / den
+ */
+static inline zmk_color_fraction_t zmk_color_fraction(uint32_t num, uint32_t den) {
+#if IS_ENABLED(CONFIG_ZMK_RGB_FX_COLOR_FIXED_POINT)
+    while (den > UINT16_MAX) {
+        num >>= 1;
+        den >>= 1;
+    }
+#endif
+
+    return ZMK_COLOR_FRACTION(num, den);
+}
+
+/**
+ * Scales a color channel by the given fraction.
+ *
+ * @param  value    Channel value
+ * @param  fraction Scaling factor
+ * @return          Scaled channel value
+ */
+static inline zmk_color_channel_t zmk_color_scale(zmk_color_channel_t value,
+                                                  zmk_color_fraction_t fraction) {
+#if IS_ENABLED(CONFIG_ZMK_RGB_FX_COLOR_FIXED_POINT)
+    // Adding the value once more makes scaling by ZMK_COLOR_MAX exact.
+    return ((uint32_t)value * fraction + value) >> 16;
+#else
+    return value * fraction;
+#endif
+}
+
+/**
+ * Scales all channels of an RGB color by the given fraction.
+ *
+ * @param rgb      Color to scale
+ * @param result   Scaled color
+ * @param fraction Scaling factor
+ */
+static inline void zmk_scale_rgb(const struct zmk_color_rgb *rgb, struct zmk_color_rgb *result,
+                                 zmk_color_fraction_t fraction) {
+    ZMK_RGB_FX_COUNT_OPS(1);
+
+    result->r = zmk_color_scale(rgb->r, fraction);
+    result->g = zmk_color_scale(rgb->g, fraction);
+    result->b = zmk_color_scale(rgb->b, fraction);
+}
+
 /**
  * Converts color from HSL to RGB.
  *
@@ -57,6 +165,24 @@ void zmk_hsl_to_rgb(const struct zmk_color_hsl *hsl, struct zmk_color_rgb *rgb);
  */
 void zmk_rgb_to_led_rgb(const struct zmk_color_rgb *rgb, struct led_rgb *led);
 
+/**
+ * Converts an array of colors into led_rgb structs.
+ *
+ * @param rgb   Colors to convert
+ * @param led   Converted colors
+ * @param count Number of colors
+ */
+void zmk_rgb_to_led_rgb_span(const struct zmk_color_rgb *rgb, struct led_rgb *led, size_t count);
+
+/**
+ * Scales all channels of an array of colors by the given fraction, in place.
+ *
+ * @param colors   Colors to scale
+ * @param count    Number of colors
+ * @param fraction Scaling factor
+ */
+void zmk_scale_span(struct zmk_color_rgb *colors, size_t count, zmk_color_fraction_t fraction);
+
 /**
  * Returns true if two HSL colors are the same.
  *
@@ -76,7 +202,7 @@ bool zmk_cmp_hsl(const struct zmk_color_hsl *a, const struct zmk_color_hsl *b);
  * @param step   Interpolation step
  */
 void zmk_interpolate_hsl(const struct zmk_color_hsl *from, const struct zmk_color_hsl *to,
-                         struct zmk_color_hsl *result, float step);
+                         struct zmk_color_hsl *result, zmk_color_fraction_t step);
 
 /**
  * Perform linear interpolation between RGB values of two colors
@@ -88,16 +214,120 @@ void zmk_interpolate_hsl(const struct zmk_color_hsl *from, const struct zmk_colo
  * @param step   Interpolation step
  */
 void zmk_interpolate_rgb(const struct zmk_color_rgb *from, const struct zmk_color_rgb *to,
-                         struct zmk_color_rgb *result, float step);
+                         struct zmk_color_rgb *result, zmk_color_fraction_t step);
 
 void zmk_rgb_fx_request_frames(uint32_t frames);
 
+/**
+ * Requests frames to be rendered at no more than the given frame rate.
+ *
+ * The animation runs at the highest frame rate requested by the active effects,
+ * capped by the maximum frame rate and the power state of the keyboard.
+ *
+ * @param frames Number of frames to render
+ * @param fps    Frame rate the effect needs, 0 if it doesn't have a preference
+ */
+void zmk_rgb_fx_request_frames_at(uint32_t frames, uint8_t fps);
+
+/**
+ * Changes the maximum frame rate at runtime. Effects advance by the elapsed time,
+ * so the speed of the animations stays the same.
+ *
+ * @param  fps Frames per second, between 1 and 60
+ * @return     0 on success, -EINVAL if the frame rate is out of range
+ */
+int zmk_rgb_fx_set_fps(uint8_t fps);
+
+/**
+ * Returns the frame rate the animation is currently running at.
+ */
+uint8_t zmk_rgb_fx_get_fps(void);
+
+/**
+ * Returns the work queue used for rendering, which effects should also use for their own work.
+ * This is the system work queue unless CONFIG_ZMK_RGB_FX_WORK_QUEUE is enabled.
+ * Changes to the state of the effects made from other contexts should be submitted to it,
+ * so they can't happen in the middle of a frame.
+ */
+struct k_work_q *zmk_rgb_fx_work_q(void);
+
+struct zmk_rgb_fx_frame_timing {
+    /**
+     * Time spent rendering the effects and converting the pixels for the LED drivers.
+     */
+    uint32_t render_ns;
+
+    /**
+     * Time spent waiting for the previous frame to finish transmitting.
+     */
+    uint32_t stall_ns;
+
+    /**
+     * Time spent sending the frame to the LED drivers.
+     */
+    uint32_t transmit_ns;
+};
+
+/**
+ * Returns the duration of each stage of the last frame.
+ *
+ * With CONFIG_ZMK_RGB_FX_ASYNC_OUTPUT, the transmission overlaps the rendering of the next frame,
+ * so the stages add up to more than the time spent in the animation work item.
+ */
+void zmk_rgb_fx_get_frame_timing(struct zmk_rgb_fx_frame_timing *timing);
+
+#if IS_ENABLED(CONFIG_ZMK_RGB_FX_SKIP_UNCHANGED)
+/**
+ * Returns the number of LED driver updates which were skipped
+ * because the pixels handled by the driver did not change.
+ */
+uint32_t zmk_rgb_fx_get_skipped_transfers(void);
+#endif
+
+/**
+ * Blends a span of colors onto the frame with a fixed blending mode.
+ *
+ * @param colors    Frame colors, blended in place
+ * @param pixel_map Frame indices of the span, NULL if the span is colors[0..count)
+ * @param blend     Colors to blend, one for each pixel of the span
+ * @param count     Number of pixels in the span
+ */
+typedef void (*zmk_blend_span_t)(struct zmk_color_rgb *colors,
+                                 const zmk_rgb_fx_pixel_idx_t *pixel_map,
+                                 const struct zmk_color_rgb *blend, size_t count);
+
+void zmk_blend_span_normal(struct zmk_color_rgb *colors, const zmk_rgb_fx_pixel_idx_t *pixel_map,
+                           const struct zmk_color_rgb *blend, size_t count);
+void zmk_blend_span_multiply(struct zmk_color_rgb *colors, const zmk_rgb_fx_pixel_idx_t *pixel_map,
+                             const struct zmk_color_rgb *blend, size_t count);
+void zmk_blend_span_lighten(struct zmk_color_rgb *colors, const zmk_rgb_fx_pixel_idx_t *pixel_map,
+                            const struct zmk_color_rgb *blend, size_t count);
+void zmk_blend_span_darken(struct zmk_color_rgb *colors, const zmk_rgb_fx_pixel_idx_t *pixel_map,
+                           const struct zmk_color_rgb *blend, size_t count);
+void zmk_blend_span_screen(struct zmk_color_rgb *colors, const zmk_rgb_fx_pixel_idx_t *pixel_map,
+                           const struct zmk_color_rgb *blend, size_t count);
+void zmk_blend_span_subtract(struct zmk_color_rgb *colors, const zmk_rgb_fx_pixel_idx_t *pixel_map,
+                             const struct zmk_color_rgb *blend, size_t count);
+
+/**
+ * Resolves the span kernel for a blending-mode devicetree property at build time, e.g.
+ * ZMK_BLEND_SPAN(DT_INST_STRING_TOKEN(idx, blending_mode)).
+ */
+#define ZMK_BLEND_SPAN(mode) UTIL_CAT(zmk_blend_span_, mode)
+
+/**
+ * Number of pixels effects generate into a stack buffer before handing them to a span kernel.
+ */
+#define ZMK_BLEND_SPAN_SIZE 16
+
 struct zmk_color_rgb __zmk_apply_blending_mode(struct zmk_color_rgb base_value,
                                                struct zmk_color_rgb blend_value, uint8_t mode);
 
 static inline struct zmk_color_rgb zmk_apply_blending_mode(struct zmk_color_rgb base_value,
                                                            struct zmk_color_rgb blend_value,
                                                            uint8_t mode) {
+    ZMK_RGB_FX_COUNT_OPS(1);
+
     if (mode == ZMK_RGB_FX_BLENDING_MODE_NORMAL) {
         return blend_value;
     }
@@ -21,4 +21,13 @@
 #define RGB_FX_CMD_NEXT_CONTROL_ZONE 6
 #define RGB_FX_CMD_PREVIOUS_CONTROL_ZONE 7
 
+/**
+ * Applies a command to a control group. A frame being rendered is finished first,
+ * so the change is in effect by the time this returns. Must not be called from an ISR.
+ *
+ * @param  dev     Control group
+ * @param  command One of the RGB_FX_CMD_* commands
+ * @param  param   Parameter of the command
+ * @return         0 on success, -ENOTSUP if the parameter is out of range
+ */
 int zmk_rgb_fx_control_handle_command(const struct device *dev, uint8_t command, uint8_t param);
@@ -0,0 +1,20 @@
+/*
+ * Copyright (c) 2024 Kuba Birecki
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+#include <zephyr/drivers/led_strip.h>
+#include <zephyr/kernel.h>
+
+/**
+ * Called by the animation tick before the effects render a frame.
+ */
+void zmk_rgb_fx_frame_dump_begin_frame(void);
+
+/**
+ * Called by the animation tick with the pixels of a frame, as they're sent to the LED drivers.
+ */
+void zmk_rgb_fx_frame_dump_end_frame(const struct led_rgb *pixels, size_t num_pixels);
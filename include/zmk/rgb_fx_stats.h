@@ -0,0 +1,40 @@
+/*
+ * Copyright (c) 2024 Kuba Birecki
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+#include <zephyr/device.h>
+#include <zephyr/kernel.h>
+
+/**
+ * Stages of the animation tick which are timed in addition to the effects themselves.
+ */
+enum zmk_rgb_fx_stats_phase {
+    ZMK_RGB_FX_STATS_PHASE_FRAME,
+    ZMK_RGB_FX_STATS_PHASE_CONVERT,
+    ZMK_RGB_FX_STATS_PHASE_STALL,
+    ZMK_RGB_FX_STATS_PHASE_TRANSMIT,
+    ZMK_RGB_FX_STATS_PHASE_COUNT,
+};
+
+/**
+ * Records the duration of a single render_frame call of the given effect device.
+ * Effects which render other effects (compose, control group) include the time of their children.
+ */
+void zmk_rgb_fx_stats_record_fx(const struct device *dev, uint32_t cycles);
+
+/**
+ * Records the duration of a phase of the animation tick.
+ * Frames longer than the current frame period are counted as late.
+ */
+void zmk_rgb_fx_stats_record_phase(enum zmk_rgb_fx_stats_phase phase, uint32_t cycles);
+
+/**
+ * Records a frame which was dropped because the previous one was still being processed.
+ */
+void zmk_rgb_fx_stats_record_missed_frame(void);
+
+void zmk_rgb_fx_stats_reset(void);
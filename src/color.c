@@ -5,21 +5,199 @@
  */
 
 #include <stdlib.h>
+#include <string.h>
 
 #include <zmk/rgb_fx.h>
 
-static float float_mod(float a, float b) {
-    float mod = a < 0 ? -a : a;
-    float x = b < 0 ? -b : b;
+#if IS_ENABLED(CONFIG_ZMK_RGB_FX_SIMD)
+#if defined(__ARM_NEON)
+#include <arm_neon.h>
+#define COLOR_SIMD 1
+#define COLOR_SIMD_NARROW 1
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#define COLOR_SIMD 1
+#define COLOR_SIMD_NARROW 1
+#elif defined(__ARM_FEATURE_DSP)
+#include <arm_acle.h>
+#define COLOR_SIMD 1
+#endif
+#endif /* IS_ENABLED(CONFIG_ZMK_RGB_FX_SIMD) */
 
-    while (mod >= x) {
-        mod = mod - x;
+#if IS_ENABLED(CONFIG_ZMK_RGB_FX_OP_COUNT)
+uint32_t zmk_rgb_fx_op_count = 0;
+
+uint32_t zmk_rgb_fx_get_op_count(void) { return zmk_rgb_fx_op_count; }
+#endif
+
+/**
+ * Channel assignment for each 60 degree hue sector.
+ * Index 0 selects the minimum (m), 1 the intermediate (m + x) and 2 the maximum (m + chroma).
+ */
+static const uint8_t hue_sectors[6][3] = {
+    {2, 1, 0}, {1, 2, 0}, {0, 2, 1}, {0, 1, 2}, {1, 0, 2}, {2, 0, 1},
+};
+
+#if IS_ENABLED(CONFIG_ZMK_RGB_FX_COLOR_FIXED_POINT)
+
+/**
+ * Scales a signed integer by a fraction, rounding towards zero.
+ */
+static int32_t int_scale(int32_t value, zmk_color_fraction_t fraction) {
+    if (value < 0) {
+        return -(int32_t)(((uint32_t)-value * fraction + (uint32_t)-value) >> 16);
     }
 
-    return a < 0 ? -mod : mod;
+    return ((uint32_t)value * fraction + (uint32_t)value) >> 16;
+}
+
+#endif /* IS_ENABLED(CONFIG_ZMK_RGB_FX_COLOR_FIXED_POINT) */
+
+#if defined(COLOR_SIMD)
+
+/*
+ * Packed kernels operate on the colors as flat arrays of Q0.16 channels. A block of
+ * SIMD_LANES pixels always spans exactly three vectors, whichever channel each lane holds.
+ */
+BUILD_ASSERT(sizeof(struct zmk_color_rgb) == 3 * sizeof(uint16_t));
+
+#if defined(__ARM_NEON)
+
+#define SIMD_LANES 8
+
+typedef uint16x8_t simd_t;
+
+static ALWAYS_INLINE simd_t simd_load(const uint16_t *src) { return vld1q_u16(src); }
+static ALWAYS_INLINE void simd_store(uint16_t *dst, simd_t v) { vst1q_u16(dst, v); }
+static ALWAYS_INLINE simd_t simd_dup(uint16_t value) { return vdupq_n_u16(value); }
+static ALWAYS_INLINE simd_t simd_add(simd_t a, simd_t b) { return vaddq_u16(a, b); }
+static ALWAYS_INLINE simd_t simd_sub(simd_t a, simd_t b) { return vsubq_u16(a, b); }
+static ALWAYS_INLINE simd_t simd_max(simd_t a, simd_t b) { return vmaxq_u16(a, b); }
+static ALWAYS_INLINE simd_t simd_min(simd_t a, simd_t b) { return vminq_u16(a, b); }
+
+static ALWAYS_INLINE simd_t simd_scale(simd_t a, simd_t b) {
+    const uint32x4_t lo = vmlal_u16(vmovl_u16(vget_low_u16(a)), vget_low_u16(a), vget_low_u16(b));
+    const uint32x4_t hi =
+        vmlal_u16(vmovl_u16(vget_high_u16(a)), vget_high_u16(a), vget_high_u16(b));
+
+    return vcombine_u16(vshrn_n_u32(lo, 16), vshrn_n_u32(hi, 16));
+}
+
+static ALWAYS_INLINE void simd_store_high_bytes(uint8_t *dst, simd_t v) {
+    vst1_u8(dst, vshrn_n_u16(v, 8));
+}
+
+#elif defined(__SSE2__)
+
+#define SIMD_LANES 8
+
+typedef __m128i simd_t;
+
+static ALWAYS_INLINE simd_t simd_load(const uint16_t *src) {
+    return _mm_loadu_si128((const __m128i *)src);
 }
+static ALWAYS_INLINE void simd_store(uint16_t *dst, simd_t v) {
+    _mm_storeu_si128((__m128i *)dst, v);
+}
+static ALWAYS_INLINE simd_t simd_dup(uint16_t value) { return _mm_set1_epi16((short)value); }
+static ALWAYS_INLINE simd_t simd_add(simd_t a, simd_t b) { return _mm_add_epi16(a, b); }
+static ALWAYS_INLINE simd_t simd_sub(simd_t a, simd_t b) { return _mm_sub_epi16(a, b); }
+
+// SSE2 has no unsigned 16-bit min/max, saturating arithmetic gives the same result.
+static ALWAYS_INLINE simd_t simd_max(simd_t a, simd_t b) {
+    return _mm_adds_epu16(_mm_subs_epu16(a, b), b);
+}
+static ALWAYS_INLINE simd_t simd_min(simd_t a, simd_t b) {
+    return _mm_subs_epu16(a, _mm_subs_epu16(a, b));
+}
+
+static ALWAYS_INLINE simd_t simd_scale(simd_t a, simd_t b) {
+    const __m128i lo = _mm_mullo_epi16(a, b);
+    const __m128i hi = _mm_mulhi_epu16(a, b);
 
-static float float_abs(float a) { return a < 0 ? -a : a; }
+    // Adding a to the low half carries into the result exactly when the saturating sum differs,
+    // in which case no_carry is 0 instead of -1.
+    const __m128i no_carry = _mm_cmpeq_epi16(_mm_adds_epu16(lo, a), _mm_add_epi16(lo, a));
+
+    return _mm_add_epi16(_mm_add_epi16(hi, no_carry), _mm_set1_epi16(1));
+}
+
+static ALWAYS_INLINE void simd_store_high_bytes(uint8_t *dst, simd_t v) {
+    _mm_storel_epi64((__m128i *)dst, _mm_packus_epi16(_mm_srli_epi16(v, 8), _mm_setzero_si128()));
+}
+
+#elif defined(__ARM_FEATURE_DSP)
+
+#define SIMD_LANES 2
+
+typedef uint32_t simd_t;
+
+static ALWAYS_INLINE simd_t simd_load(const uint16_t *src) {
+    simd_t v;
+
+    // Channels are only 16-bit aligned, memcpy keeps the compiler from using LDRD/LDM.
+    memcpy(&v, src, sizeof(v));
+    return v;
+}
+static ALWAYS_INLINE void simd_store(uint16_t *dst, simd_t v) { memcpy(dst, &v, sizeof(v)); }
+static ALWAYS_INLINE simd_t simd_dup(uint16_t value) { return value | ((uint32_t)value << 16); }
+static ALWAYS_INLINE simd_t simd_add(simd_t a, simd_t b) { return __uadd16(a, b); }
+static ALWAYS_INLINE simd_t simd_sub(simd_t a, simd_t b) { return __usub16(a, b); }
+static ALWAYS_INLINE simd_t simd_max(simd_t a, simd_t b) { return __uqadd16(__uqsub16(a, b), b); }
+static ALWAYS_INLINE simd_t simd_min(simd_t a, simd_t b) { return __uqsub16(a, __uqsub16(a, b)); }
+
+// There's no packed unsigned high-half multiply, each lane is scaled with a single UMLA.
+static ALWAYS_INLINE simd_t simd_scale(simd_t a, simd_t b) {
+    const uint32_t a_lo = a & 0xFFFF;
+    const uint32_t a_hi = a >> 16;
+
+    return ((a_lo * (b & 0xFFFF) + a_lo) >> 16) | ((a_hi * (b >> 16) + a_hi) & 0xFFFF0000);
+}
+
+#endif
+
+/**
+ * Same as blend_channel() below, for every lane of a vector.
+ */
+static ALWAYS_INLINE simd_t simd_blend(simd_t base, simd_t blend, uint8_t mode) {
+    switch (mode) {
+    case ZMK_RGB_FX_BLENDING_MODE_MULTIPLY:
+        return simd_scale(base, blend);
+    case ZMK_RGB_FX_BLENDING_MODE_LIGHTEN:
+        return simd_max(base, blend);
+    case ZMK_RGB_FX_BLENDING_MODE_DARKEN:
+        return simd_min(base, blend);
+    case ZMK_RGB_FX_BLENDING_MODE_SCREEN:
+        return simd_add(base, simd_scale(simd_sub(simd_dup(ZMK_COLOR_MAX), base), blend));
+    case ZMK_RGB_FX_BLENDING_MODE_SUBTRACT:
+        return simd_sub(base, simd_scale(base, blend));
+    default:
+        return blend;
+    }
+}
+
+/**
+ * Blends whole blocks of SIMD_LANES pixels.
+ *
+ * @return Number of pixels blended
+ */
+static ALWAYS_INLINE size_t simd_blend_span(struct zmk_color_rgb *colors,
+                                            const struct zmk_color_rgb *blend, size_t count,
+                                            uint8_t mode) {
+    uint16_t *dst = (uint16_t *)colors;
+    const uint16_t *src = (const uint16_t *)blend;
+    size_t i = 0;
+
+    for (; i + SIMD_LANES <= count; i += SIMD_LANES) {
+        for (size_t k = 3 * i; k < 3 * (i + SIMD_LANES); k += SIMD_LANES) {
+            simd_store(&dst[k], simd_blend(simd_load(&dst[k]), simd_load(&src[k]), mode));
+        }
+    }
+
+    return i;
+}
+
+#endif /* defined(COLOR_SIMD) */
 
 /**
  * HSL chosen over HSV/HSB as it shares the same parameters with LCh or HSLuv.
@@ -29,59 +207,118 @@ static float float_abs(float a) { return a < 0 ? -a : a; }
  * using a single config flag.
  *
  * Algorithm source: https://www.tlbx.app/color-converter
+ *
+ * The conversion is done in integer math for both color representations. The channels are
+ * computed exactly in units of 1/600000, the common denominator of the percentages and of the
+ * 60 degrees of a hue sector, and only rounded once when they're scaled to Q0.16. This keeps the
+ * result within 1/65535 of the original floating point conversion.
  */
 void zmk_hsl_to_rgb(const struct zmk_color_hsl *hsl, struct zmk_color_rgb *rgb) {
-    float s = (float)hsl->s / 100;
-    float l = (float)hsl->l / 100;
-
-    float a = (float)hsl->h / 60;
-    float chroma = s * (1 - float_abs(2 * l - 1));
-    float x = chroma * (1 - float_abs(float_mod(a, 2) - 1));
-    float m = l - chroma / 2;
-
-    switch ((uint8_t)a % 6) {
-    case 0:
-        rgb->r = m + chroma;
-        rgb->g = m + x;
-        rgb->b = m;
-        break;
-    case 1:
-        rgb->r = m + x;
-        rgb->g = m + chroma;
-        rgb->b = m;
-        break;
-    case 2:
-        rgb->r = m;
-        rgb->g = m + chroma;
-        rgb->b = m + x;
-        break;
-    case 3:
-        rgb->r = m;
-        rgb->g = m + x;
-        rgb->b = m + chroma;
-        break;
-    case 4:
-        rgb->r = m + x;
-        rgb->g = m;
-        rgb->b = m + chroma;
-        break;
-    case 5:
-        rgb->r = m + chroma;
-        rgb->g = m;
-        rgb->b = m + x;
-        break;
-    }
+    ZMK_RGB_FX_COUNT_OPS(1);
+
+    const int32_t lightness = 2 * hsl->l - 100;
+    const uint32_t saturation = (uint32_t)hsl->s * (100 - (lightness < 0 ? -lightness : lightness));
+
+    const uint8_t sector = (hsl->h / 60) % 6;
+    const uint8_t remainder = hsl->h % 60;
+
+    const uint32_t chroma = saturation * 60;
+    const uint32_t x = saturation * ((sector & 1) ? 60 - remainder : remainder);
+    const uint32_t m = (uint32_t)hsl->l * 6000 - chroma / 2;
+
+    // 65535 / 600000 reduces to 4369 / 40000, which keeps the product within 32 bits.
+    const uint32_t values[] = {
+        (m * 4369 + 20000) / 40000,
+        ((m + x) * 4369 + 20000) / 40000,
+        ((m + chroma) * 4369 + 20000) / 40000,
+    };
+
+#if IS_ENABLED(CONFIG_ZMK_RGB_FX_COLOR_FIXED_POINT)
+    rgb->r = values[hue_sectors[sector][0]];
+    rgb->g = values[hue_sectors[sector][1]];
+    rgb->b = values[hue_sectors[sector][2]];
+#else
+    rgb->r = values[hue_sectors[sector][0]] * (1.0f / UINT16_MAX);
+    rgb->g = values[hue_sectors[sector][1]] * (1.0f / UINT16_MAX);
+    rgb->b = values[hue_sectors[sector][2]] * (1.0f / UINT16_MAX);
+#endif
+}
+
+#if IS_ENABLED(CONFIG_ZMK_RGB_FX_COLOR_FIXED_POINT)
+
+/**
+ * Converts ZMKs RGB (Q0.16) to Zephyr's led_rgb (uint8_t) format.
+ */
+void zmk_rgb_to_led_rgb(const struct zmk_color_rgb *rgb, struct led_rgb *led) {
+    ZMK_RGB_FX_COUNT_OPS(1);
+
+    led->r = rgb->r >> 8;
+    led->g = rgb->g >> 8;
+    led->b = rgb->b >> 8;
 }
 
+#else
+
 /**
  * Converts ZMKs RGB (float) to Zephyr's led_rgb (uint8_t) format.
  */
 void zmk_rgb_to_led_rgb(const struct zmk_color_rgb *rgb, struct led_rgb *led) {
+    ZMK_RGB_FX_COUNT_OPS(1);
+
     led->r = rgb->r * 255;
     led->g = rgb->g * 255;
     led->b = rgb->b * 255;
 }
 
+#endif /* IS_ENABLED(CONFIG_ZMK_RGB_FX_COLOR_FIXED_POINT) */
+
+void zmk_rgb_to_led_rgb_span(const struct zmk_color_rgb *rgb, struct led_rgb *led, size_t count) {
+    size_t i = 0;
+
+#if defined(COLOR_SIMD_NARROW) && !defined(CONFIG_LED_STRIP_RGB_SCRATCH)
+    BUILD_ASSERT(sizeof(struct led_rgb) == 3);
+
+    // Without the scratch byte, led_rgb is a packed array of channels in the same order.
+    const uint16_t *src = (const uint16_t *)rgb;
+    uint8_t *dst = (uint8_t *)led;
+
+    for (; i + SIMD_LANES <= count; i += SIMD_LANES) {
+        for (size_t k = 3 * i; k < 3 * (i + SIMD_LANES); k += SIMD_LANES) {
+            simd_store_high_bytes(&dst[k], simd_load(&src[k]));
+        }
+    }
+
+    // The remaining pixels are counted by zmk_rgb_to_led_rgb().
+    ZMK_RGB_FX_COUNT_OPS(i);
+#endif
+
+    for (; i < count; ++i) {
+        zmk_rgb_to_led_rgb(&rgb[i], &led[i]);
+    }
+}
+
+void zmk_scale_span(struct zmk_color_rgb *colors, size_t count, zmk_color_fraction_t fraction) {
+    size_t i = 0;
+
+#if defined(COLOR_SIMD)
+    uint16_t *channels = (uint16_t *)colors;
+    const simd_t factor = simd_dup(fraction);
+
+    for (; i + SIMD_LANES <= count; i += SIMD_LANES) {
+        for (size_t k = 3 * i; k < 3 * (i + SIMD_LANES); k += SIMD_LANES) {
+            simd_store(&channels[k], simd_scale(simd_load(&channels[k]), factor));
+        }
+    }
+
+    // The remaining pixels are counted by zmk_scale_rgb().
+    ZMK_RGB_FX_COUNT_OPS(i);
+#endif
+
+    for (; i < count; ++i) {
+        zmk_scale_rgb(&colors[i], &colors[i], fraction);
+    }
+}
+
 /**
  * Compares two HSL colors.
  */
@@ -93,54 +330,144 @@ bool zmk_cmp_hsl(const struct zmk_color_hsl *a, const struct zmk_color_hsl *b) {
  * Interpolate between two colors using the cylindrical model (HSL).
  */
 void zmk_interpolate_hsl(const struct zmk_color_hsl *from, const struct zmk_color_hsl *to,
-                         struct zmk_color_hsl *result, float step) {
+                         struct zmk_color_hsl *result, zmk_color_fraction_t step) {
     int16_t hue_delta;
 
+    ZMK_RGB_FX_COUNT_OPS(1);
+
     hue_delta = from->h - to->h;
     hue_delta = hue_delta + (180 < abs(hue_delta) ? (hue_delta < 0 ? 360 : -360) : 0);
 
+#if IS_ENABLED(CONFIG_ZMK_RGB_FX_COLOR_FIXED_POINT)
+    result->h = (uint16_t)(360 + from->h - int_scale(hue_delta, step)) % 360;
+    result->s = from->s - int_scale(from->s - to->s, step);
+    result->l = from->l - int_scale(from->l - to->l, step);
+#else
     result->h = (uint16_t)(360 + from->h - (hue_delta * step)) % 360;
     result->s = from->s - (from->s - to->s) * step;
     result->l = from->l - (from->l - to->l) * step;
+#endif
 }
 
 /**
  * Interpolate between two colors using linear RGB interpolation
  */
 void zmk_interpolate_rgb(const struct zmk_color_rgb *from, const struct zmk_color_rgb *to,
-                         struct zmk_color_rgb *result, float step) {
+                         struct zmk_color_rgb *result, zmk_color_fraction_t step) {
+    ZMK_RGB_FX_COUNT_OPS(1);
+
+#if IS_ENABLED(CONFIG_ZMK_RGB_FX_COLOR_FIXED_POINT)
+    result->r = from->r + int_scale(to->r - from->r, step);
+    result->g = from->g + int_scale(to->g - from->g, step);
+    result->b = from->b + int_scale(to->b - from->b, step);
+#else
     result->r = from->r + (to->r - from->r) * step;
     result->g = from->g + (to->g - from->g) * step;
     result->b = from->b + (to->b - from->b) * step;
+#endif
+}
+
+/**
+ * Blends a single channel. The mode is a constant in every caller,
+ * so the switch is resolved at compile time.
+ */
+static ALWAYS_INLINE zmk_color_channel_t blend_channel(zmk_color_channel_t base,
+                                                       zmk_color_channel_t blend, uint8_t mode) {
+    switch (mode) {
+    case ZMK_RGB_FX_BLENDING_MODE_MULTIPLY:
+        return zmk_color_scale(base, blend);
+    case ZMK_RGB_FX_BLENDING_MODE_LIGHTEN:
+        return base > blend ? base : blend;
+    case ZMK_RGB_FX_BLENDING_MODE_DARKEN:
+        return base > blend ? blend : base;
+    case ZMK_RGB_FX_BLENDING_MODE_SCREEN:
+        return base + zmk_color_scale(ZMK_COLOR_MAX - base, blend);
+    case ZMK_RGB_FX_BLENDING_MODE_SUBTRACT:
+        return base - zmk_color_scale(base, blend);
+    default:
+        return blend;
+    }
+}
+
+static ALWAYS_INLINE void blend_pixel(struct zmk_color_rgb *base, const struct zmk_color_rgb *blend,
+                                      uint8_t mode) {
+    base->r = blend_channel(base->r, blend->r, mode);
+    base->g = blend_channel(base->g, blend->g, mode);
+    base->b = blend_channel(base->b, blend->b, mode);
+}
+
+static ALWAYS_INLINE void blend_span(struct zmk_color_rgb *colors,
+                                     const zmk_rgb_fx_pixel_idx_t *pixel_map,
+                                     const struct zmk_color_rgb *blend, size_t count,
+                                     uint8_t mode) {
+    ZMK_RGB_FX_COUNT_OPS(count);
+
+    if (pixel_map == NULL) {
+        size_t i = 0;
+
+#if defined(COLOR_SIMD)
+        i = simd_blend_span(colors, blend, count, mode);
+#endif
+
+        for (; i < count; ++i) {
+            blend_pixel(&colors[i], &blend[i], mode);
+        }
+
+        return;
+    }
+
+    for (size_t i = 0; i < count; ++i) {
+        blend_pixel(&colors[pixel_map[i]], &blend[i], mode);
+    }
+}
+
+void zmk_blend_span_normal(struct zmk_color_rgb *colors, const zmk_rgb_fx_pixel_idx_t *pixel_map,
+                           const struct zmk_color_rgb *blend, size_t count) {
+    blend_span(colors, pixel_map, blend, count, ZMK_RGB_FX_BLENDING_MODE_NORMAL);
+}
+
+void zmk_blend_span_multiply(struct zmk_color_rgb *colors, const zmk_rgb_fx_pixel_idx_t *pixel_map,
+                             const struct zmk_color_rgb *blend, size_t count) {
+    blend_span(colors, pixel_map, blend, count, ZMK_RGB_FX_BLENDING_MODE_MULTIPLY);
+}
+
+void zmk_blend_span_lighten(struct zmk_color_rgb *colors, const zmk_rgb_fx_pixel_idx_t *pixel_map,
+                            const struct zmk_color_rgb *blend, size_t count) {
+    blend_span(colors, pixel_map, blend, count, ZMK_RGB_FX_BLENDING_MODE_LIGHTEN);
+}
+
+void zmk_blend_span_darken(struct zmk_color_rgb *colors, const zmk_rgb_fx_pixel_idx_t *pixel_map,
+                           const struct zmk_color_rgb *blend, size_t count) {
+    blend_span(colors, pixel_map, blend, count, ZMK_RGB_FX_BLENDING_MODE_DARKEN);
+}
+
+void zmk_blend_span_screen(struct zmk_color_rgb *colors, const zmk_rgb_fx_pixel_idx_t *pixel_map,
+                           const struct zmk_color_rgb *blend, size_t count) {
+    blend_span(colors, pixel_map, blend, count, ZMK_RGB_FX_BLENDING_MODE_SCREEN);
+}
+
+void zmk_blend_span_subtract(struct zmk_color_rgb *colors, const zmk_rgb_fx_pixel_idx_t *pixel_map,
+                             const struct zmk_color_rgb *blend, size_t count) {
+    blend_span(colors, pixel_map, blend, count, ZMK_RGB_FX_BLENDING_MODE_SUBTRACT);
 }
 
 struct zmk_color_rgb __zmk_apply_blending_mode(struct zmk_color_rgb base_value,
                                                struct zmk_color_rgb blend_value, uint8_t mode) {
     switch (mode) {
     case ZMK_RGB_FX_BLENDING_MODE_MULTIPLY:
-        base_value.r = base_value.r * blend_value.r;
-        base_value.g = base_value.g * blend_value.g;
-        base_value.b = base_value.b * blend_value.b;
+        blend_pixel(&base_value, &blend_value, ZMK_RGB_FX_BLENDING_MODE_MULTIPLY);
         break;
     case ZMK_RGB_FX_BLENDING_MODE_LIGHTEN:
-        base_value.r = base_value.r > blend_value.r ? base_value.r : blend_value.r;
-        base_value.g = base_value.g > blend_value.g ? base_value.g : blend_value.g;
-        base_value.b = base_value.b > blend_value.b ? base_value.b : blend_value.b;
+        blend_pixel(&base_value, &blend_value, ZMK_RGB_FX_BLENDING_MODE_LIGHTEN);
         break;
     case ZMK_RGB_FX_BLENDING_MODE_DARKEN:
-        base_value.r = base_value.r > blend_value.r ? blend_value.r : base_value.r;
-        base_value.g = base_value.g > blend_value.g ? blend_value.g : base_value.g;
-        base_value.b = base_value.b > blend_value.b ? blend_value.b : base_value.b;
+        blend_pixel(&base_value, &blend_value, ZMK_RGB_FX_BLENDING_MODE_DARKEN);
         break;
     case ZMK_RGB_FX_BLENDING_MODE_SCREEN:
-        base_value.r = base_value.r + (1.0f - base_value.r) * blend_value.r;
-        base_value.g = base_value.g + (1.0f - base_value.g) * blend_value.g;
-        base_value.b = base_value.b + (1.0f - base_value.b) * blend_value.b;
+        blend_pixel(&base_value, &blend_value, ZMK_RGB_FX_BLENDING_MODE_SCREEN);
         break;
     case ZMK_RGB_FX_BLENDING_MODE_SUBTRACT:
-        base_value.r = base_value.r - base_value.r * blend_value.r;
-        base_value.g = base_value.g - base_value.g * blend_value.g;
-        base_value.b = base_value.b - base_value.b * blend_value.b;
+        blend_pixel(&base_value, &blend_value, ZMK_RGB_FX_BLENDING_MODE_SUBTRACT);
         break;
     }
 
@@ -0,0 +1,228 @@
+/*
+ * Copyright (c) 2024 Kuba Birecki
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#define DT_DRV_COMPAT zmk_led_strip_emul
+
+#include <errno.h>
+#include <string.h>
+
+#include <zephyr/device.h>
+#include <zephyr/drivers/led_strip.h>
+#include <zephyr/kernel.h>
+#include <zephyr/logging/log.h>
+#include <zephyr/spinlock.h>
+
+#include <zmk/led_strip_emul.h>
+
+LOG_MODULE_DECLARE(zmk, CONFIG_ZMK_LOG_LEVEL);
+
+#define LED_STRIP_EMUL_PROTOCOL_WS2812 0
+#define LED_STRIP_EMUL_PROTOCOL_APA102 1
+
+/**
+ * Low time WS2812B LEDs need to latch the received data.
+ */
+#define LED_STRIP_EMUL_WS2812_RESET_NS 280000
+
+#define LED_STRIP_EMUL_CLOCK_FREQUENCY(idx)                                                        \
+    DT_INST_PROP_OR(idx, clock_frequency,                                                          \
+                    (DT_INST_ENUM_IDX(idx, protocol) == LED_STRIP_EMUL_PROTOCOL_WS2812 ? 800000    \
+                                                                                       : 4000000))
+
+struct led_strip_emul_config {
+    struct zmk_led_strip_emul_frame *frames;
+    struct led_rgb *pixels;
+    size_t chain_length;
+    size_t history_size;
+    uint32_t clock_frequency;
+    uint8_t protocol;
+    bool busy_wait;
+};
+
+struct led_strip_emul_data {
+    struct k_spinlock lock;
+
+    /**
+     * The update count also determines the history slot of the next update.
+     */
+    struct zmk_led_strip_emul_stats stats;
+};
+
+/**
+ * Number of bytes the protocol sends for the given number of pixels.
+ */
+static uint64_t led_strip_emul_bytes(const struct led_strip_emul_config *config,
+                                     size_t num_pixels) {
+    if (config->protocol == LED_STRIP_EMUL_PROTOCOL_APA102) {
+        // 32 bit start frame, a brightness byte for every pixel and an end frame
+        // providing at least one clock edge for every two pixels.
+        return 4 + 4 * num_pixels + DIV_ROUND_UP(num_pixels, 16);
+    }
+
+    return 3 * num_pixels;
+}
+
+uint32_t zmk_led_strip_emul_bus_ns(const struct device *dev, size_t num_pixels) {
+    const struct led_strip_emul_config *config = dev->config;
+
+    const uint64_t bits = led_strip_emul_bytes(config, num_pixels) * 8;
+    uint64_t bus_ns = bits * 1000000000 / config->clock_frequency;
+
+    if (config->protocol == LED_STRIP_EMUL_PROTOCOL_WS2812) {
+        bus_ns += LED_STRIP_EMUL_WS2812_RESET_NS;
+    }
+
+    return (uint32_t)bus_ns;
+}
+
+static bool led_strip_emul_pixels_equal(const struct led_rgb *a, const struct led_rgb *b,
+                                        size_t num_pixels) {
+    // Compared channel by channel, led_rgb may contain a scratch byte.
+    for (size_t i = 0; i < num_pixels; ++i) {
+        if (a[i].r != b[i].r || a[i].g != b[i].g || a[i].b != b[i].b) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+static int led_strip_emul_update_rgb(const struct device *dev, struct led_rgb *pixels,
+                                     size_t num_pixels) {
+    const struct led_strip_emul_config *config = dev->config;
+    struct led_strip_emul_data *data = dev->data;
+
+    if (num_pixels > config->chain_length) {
+        return -EINVAL;
+    }
+
+    const uint64_t now_ns = k_ticks_to_ns_floor64(k_uptime_ticks());
+    const uint32_t bus_ns = zmk_led_strip_emul_bus_ns(dev, num_pixels);
+
+    K_SPINLOCK(&data->lock) {
+        struct zmk_led_strip_emul_stats *stats = &data->stats;
+
+        if (stats->updates == 0) {
+            stats->first_ns = now_ns;
+        } else {
+            const size_t last = (stats->updates - 1) % config->history_size;
+
+            if (config->frames[last].num_pixels == num_pixels &&
+                led_strip_emul_pixels_equal(&config->pixels[last * config->chain_length], pixels,
+                                            num_pixels)) {
+                stats->redundant_updates++;
+            }
+        }
+
+        const size_t slot = stats->updates % config->history_size;
+
+        config->frames[slot].timestamp_ns = now_ns;
+        config->frames[slot].bus_ns = bus_ns;
+        config->frames[slot].num_pixels = num_pixels;
+
+        memcpy(&config->pixels[slot * config->chain_length], pixels,
+               num_pixels * sizeof(struct led_rgb));
+
+        stats->updates++;
+        stats->bytes += led_strip_emul_bytes(config, num_pixels);
+        stats->bus_ns += bus_ns;
+        stats->last_ns = now_ns;
+    }
+
+    if (config->busy_wait) {
+        k_busy_wait(DIV_ROUND_UP(bus_ns, 1000));
+    }
+
+    return 0;
+}
+
+static int led_strip_emul_update_channels(const struct device *dev, uint8_t *channels,
+                                          size_t num_channels) {
+    return -ENOTSUP;
+}
+
+int zmk_led_strip_emul_get_frame(const struct device *dev, size_t age,
+                                 struct zmk_led_strip_emul_frame *frame, struct led_rgb *pixels,
+                                 size_t size) {
+    const struct led_strip_emul_config *config = dev->config;
+    struct led_strip_emul_data *data = dev->data;
+
+    k_spinlock_key_t key = k_spin_lock(&data->lock);
+
+    if (age >= data->stats.updates || age >= config->history_size) {
+        k_spin_unlock(&data->lock, key);
+        return -ENOENT;
+    }
+
+    const size_t slot = (data->stats.updates - 1 - age) % config->history_size;
+
+    *frame = config->frames[slot];
+
+    if (pixels != NULL && size < frame->num_pixels) {
+        k_spin_unlock(&data->lock, key);
+        return -ENOMEM;
+    }
+
+    if (pixels != NULL) {
+        memcpy(pixels, &config->pixels[slot * config->chain_length],
+               frame->num_pixels * sizeof(struct led_rgb));
+    }
+
+    k_spin_unlock(&data->lock, key);
+
+    return 0;
+}
+
+void zmk_led_strip_emul_get_stats(const struct device *dev,
+                                  struct zmk_led_strip_emul_stats *stats) {
+    struct led_strip_emul_data *data = dev->data;
+
+    K_SPINLOCK(&data->lock) { *stats = data->stats; }
+}
+
+void zmk_led_strip_emul_reset(const struct device *dev) {
+    struct led_strip_emul_data *data = dev->data;
+
+    K_SPINLOCK(&data->lock) { memset(&data->stats, 0, sizeof(data->stats)); }
+}
+
+static int led_strip_emul_init(const struct device *dev) { return 0; }
+
+static const struct led_strip_driver_api led_strip_emul_api = {
+    .update_rgb = led_strip_emul_update_rgb,
+    .update_channels = led_strip_emul_update_channels,
+};
+
+#define LED_STRIP_EMUL_DEVICE(idx)                                                                 \
+                                                                                                   \
+    BUILD_ASSERT(DT_INST_PROP(idx, history_size) > 0,                                              \
+                 "zmk,led-strip-emul needs to keep at least one update");                          \
+    BUILD_ASSERT(LED_STRIP_EMUL_CLOCK_FREQUENCY(idx) > 0,                                          \
+                 "zmk,led-strip-emul clock-frequency must be positive");                           \
+                                                                                                   \
+    static struct zmk_led_strip_emul_frame                                                         \
+        led_strip_emul_##idx##_frames[DT_INST_PROP(idx, history_size)];                            \
+                                                                                                   \
+    static struct led_rgb led_strip_emul_##idx##_pixels[DT_INST_PROP(idx, history_size) *          \
+                                                        DT_INST_PROP(idx, chain_length)];          \
+                                                                                                   \
+    static const struct led_strip_emul_config led_strip_emul_##idx##_config = {                    \
+        .frames = led_strip_emul_##idx##_frames,                                                   \
+        .pixels = led_strip_emul_##idx##_pixels,                                                   \
+        .chain_length = DT_INST_PROP(idx, chain_length),                                           \
+        .history_size = DT_INST_PROP(idx, history_size),                                           \
+        .clock_frequency = LED_STRIP_EMUL_CLOCK_FREQUENCY(idx),                                    \
+        .protocol = DT_INST_ENUM_IDX(idx, protocol),                                               \
+        .busy_wait = DT_INST_PROP(idx, busy_wait),                                                 \
+    };                                                                                             \
+                                                                                                   \
+    static struct led_strip_emul_data led_strip_emul_##idx##_data;                                 \
+                                                                                                   \
+    DEVICE_DT_INST_DEFINE(idx, &led_strip_emul_init, NULL, &led_strip_emul_##idx##_data,           \
+                          &led_strip_emul_##idx##_config, POST_KERNEL,                             \
+                          CONFIG_LED_STRIP_INIT_PRIORITY, &led_strip_emul_api);
+
+DT_INST_FOREACH_STATUS_OKAY(LED_STRIP_EMUL_DEVICE);
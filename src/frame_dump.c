@@ -0,0 +1,533 @@
+/*
+ * Copyright (c) 2024 Kuba Birecki
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <errno.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <zephyr/device.h>
+#include <zephyr/drivers/led_strip.h>
+#include <zephyr/kernel.h>
+#include <zephyr/sys/atomic.h>
+#include <zephyr/sys/printk.h>
+
+#include "cmdline.h"
+#include "posix_board_if.h"
+#include "soc.h"
+
+#include <drivers/rgb_fx.h>
+
+#include <zmk/rgb_fx.h>
+#include <zmk/rgb_fx_frame_dump.h>
+#include <zmk/events/position_state_changed.h>
+
+#define FRAME_DUMP_MAGIC "RGFX"
+#define FRAME_DUMP_VERSION 1
+
+/**
+ * How long a key from the timeline is held when the entry doesn't specify it.
+ */
+#define FRAME_DUMP_DEFAULT_HOLD_MS 100
+
+/**
+ * The dump starts with this header, followed by the position of every pixel as two bytes (x, y).
+ * All fields are in the byte order of the host.
+ */
+struct rgb_fx_frame_dump_header {
+    char magic[4];
+    uint16_t version;
+    uint16_t num_pixels;
+    uint16_t fps;
+    uint16_t reserved;
+} __packed;
+
+/**
+ * Every frame rendered by the animation starts with this header, followed by three bytes
+ * (r, g, b) for every pixel, exactly as they're sent to the LED drivers.
+ */
+struct rgb_fx_frame_dump_frame {
+    /**
+     * Uptime when the frame was rendered, relative to the start of the dump.
+     */
+    uint32_t time_ms;
+    uint32_t render_ns;
+} __packed;
+
+/**
+ * Key press of the timeline.
+ */
+struct rgb_fx_frame_dump_key {
+    uint32_t press_ms;
+    uint32_t position;
+    uint32_t hold_ms;
+};
+
+uint64_t zmk_rgb_fx_frame_dump_host_ns(void);
+int zmk_rgb_fx_frame_dump_open(const char *path);
+int zmk_rgb_fx_frame_dump_write(const void *data, size_t len);
+int zmk_rgb_fx_frame_dump_close(void);
+int zmk_rgb_fx_frame_dump_open_golden(const char *path);
+int zmk_rgb_fx_frame_dump_read_golden(void *data, size_t len);
+int zmk_rgb_fx_frame_dump_close_golden(void);
+
+static uint8_t out_buffer[RGB_FX_NUM_PIXELS * 3];
+
+static uint8_t golden_buffer[RGB_FX_NUM_PIXELS * 3];
+
+/**
+ * Defaults from Kconfig, which can be overridden on the command line of the executable.
+ */
+static char *dump_path = CONFIG_ZMK_RGB_FX_FRAME_DUMP_PATH;
+static char *dump_keys = CONFIG_ZMK_RGB_FX_FRAME_DUMP_KEYS;
+static uint32_t dump_frames = CONFIG_ZMK_RGB_FX_FRAME_DUMP_FRAMES;
+static char *golden_path = CONFIG_ZMK_RGB_FX_FRAME_DUMP_GOLDEN;
+static uint32_t golden_tolerance = CONFIG_ZMK_RGB_FX_FRAME_DUMP_TOLERANCE;
+static uint32_t budget_ops = CONFIG_ZMK_RGB_FX_FRAME_DUMP_BUDGET_OPS;
+
+/**
+ * Set while the frames rendered by the animation are written to the dump.
+ */
+static atomic_t recording = ATOMIC_INIT(0);
+
+static bool check_golden;
+
+/**
+ * Uptime the frame and key times are relative to.
+ */
+static int64_t start_ms;
+
+/**
+ * Length of the dump, frames rendered after it are left out.
+ */
+static uint32_t duration_ms;
+
+static uint64_t frame_start_ns;
+static uint32_t frame_start_ops;
+
+static uint32_t frame_count = 0;
+static uint32_t failed_frames = 0;
+static uint64_t total_ns = 0;
+static uint32_t max_ns = 0;
+static uint32_t max_ops = 0;
+
+/**
+ * Set if a frame couldn't be written, which ends the recording.
+ */
+static int write_error = 0;
+
+static void rgb_fx_frame_dump_options(void) {
+    static struct args_struct_t options[] = {
+        {
+            .option = "rgb-fx-dump",
+            .name = "path",
+            .type = 's',
+            .dest = (void *)&dump_path,
+            .descript = "File the rendered frames are written to",
+        },
+        {
+            .option = "rgb-fx-frames",
+            .name = "count",
+            .type = 'u',
+            .dest = (void *)&dump_frames,
+            .descript = "Length of the dump in frame periods",
+        },
+        {
+            .option = "rgb-fx-keys",
+            .name = "timeline",
+            .type = 's',
+            .dest = (void *)&dump_keys,
+            .descript = "Key presses as a comma-separated list of ms:position[:hold_ms]",
+        },
+        {
+            .option = "rgb-fx-golden",
+            .name = "path",
+            .type = 's',
+            .dest = (void *)&golden_path,
+            .descript = "Earlier dump the rendered frames are compared against",
+        },
+        {
+            .option = "rgb-fx-tolerance",
+            .name = "value",
+            .type = 'u',
+            .dest = (void *)&golden_tolerance,
+            .descript = "Largest difference of a color channel from the golden frames",
+        },
+        {
+            .option = "rgb-fx-budget",
+            .name = "ops",
+            .type = 'u',
+            .dest = (void *)&budget_ops,
+            .descript = "Most pixel operations a single frame may take, 0 to disable",
+        },
+        ARG_TABLE_ENDMARKER,
+    };
+
+    native_add_command_line_opts(options);
+}
+
+NATIVE_TASK(rgb_fx_frame_dump_options, PRE_BOOT_1, 1);
+
+static void rgb_fx_frame_dump_raise_key(uint32_t position, bool pressed) {
+    raise_zmk_position_state_changed((struct zmk_position_state_changed){
+        .source = ZMK_POSITION_STATE_CHANGE_SOURCE_LOCAL,
+        .position = position,
+        .state = pressed,
+        .timestamp = k_uptime_get(),
+    });
+}
+
+/**
+ * Parses the key press at the start of the timeline.
+ *
+ * @return The rest of the timeline, or NULL if the entry is malformed
+ */
+static const char *rgb_fx_frame_dump_parse_key(const char *entry,
+                                               struct rgb_fx_frame_dump_key *key) {
+    char *end;
+
+    key->press_ms = strtoul(entry, &end, 10);
+
+    if (end == entry || *end != ':') {
+        return NULL;
+    }
+
+    entry = end + 1;
+    key->position = strtoul(entry, &end, 10);
+
+    if (end == entry) {
+        return NULL;
+    }
+
+    key->hold_ms = FRAME_DUMP_DEFAULT_HOLD_MS;
+
+    if (*end == ':') {
+        entry = end + 1;
+        key->hold_ms = strtoul(entry, &end, 10);
+
+        if (end == entry) {
+            return NULL;
+        }
+    }
+
+    if (*end == ',') {
+        return end + 1;
+    }
+
+    return *end == '\0' ? end : NULL;
+}
+
+/**
+ * @return 0 on success, -EINVAL if the timeline is malformed
+ */
+static int rgb_fx_frame_dump_check_keys(const char *timeline) {
+    struct rgb_fx_frame_dump_key key;
+
+    while (*timeline != '\0') {
+        if ((timeline = rgb_fx_frame_dump_parse_key(timeline, &key)) == NULL) {
+            return -EINVAL;
+        }
+    }
+
+    return 0;
+}
+
+/**
+ * Finds the earliest press or release of the timeline which happens at or after from_ms.
+ *
+ * @return True if there is one
+ */
+static bool rgb_fx_frame_dump_next_key(const char *timeline, uint32_t from_ms,
+                                       uint32_t *next_ms) {
+    struct rgb_fx_frame_dump_key key;
+    bool found = false;
+
+    while (*timeline != '\0') {
+        timeline = rgb_fx_frame_dump_parse_key(timeline, &key);
+
+        const uint32_t times[] = {key.press_ms, key.press_ms + key.hold_ms};
+
+        for (size_t i = 0; i < ARRAY_SIZE(times); ++i) {
+            if (times[i] >= from_ms && (!found || times[i] < *next_ms)) {
+                *next_ms = times[i];
+                found = true;
+            }
+        }
+    }
+
+    return found;
+}
+
+/**
+ * Raises the key events of the timeline which happen at the given time.
+ */
+static void rgb_fx_frame_dump_raise_keys(const char *timeline, uint32_t time_ms) {
+    struct rgb_fx_frame_dump_key key;
+
+    while (*timeline != '\0') {
+        timeline = rgb_fx_frame_dump_parse_key(timeline, &key);
+
+        if (key.press_ms == time_ms) {
+            rgb_fx_frame_dump_raise_key(key.position, true);
+        }
+
+        if (key.press_ms + key.hold_ms == time_ms) {
+            rgb_fx_frame_dump_raise_key(key.position, false);
+        }
+    }
+}
+
+/**
+ * Converts the pixels of a frame into the bytes written to the dump.
+ */
+static void rgb_fx_frame_dump_convert(const struct led_rgb *pixels, size_t num_pixels) {
+    // led_rgb may carry padding or a scratch byte, so only the channels are written.
+    for (size_t i = 0; i < num_pixels; ++i) {
+        out_buffer[i * 3] = pixels[i].r;
+        out_buffer[i * 3 + 1] = pixels[i].g;
+        out_buffer[i * 3 + 2] = pixels[i].b;
+    }
+}
+
+static int rgb_fx_frame_dump_write_frame(uint32_t time_ms, uint32_t render_ns) {
+    const struct rgb_fx_frame_dump_frame header = {
+        .time_ms = time_ms,
+        .render_ns = render_ns,
+    };
+
+    if (zmk_rgb_fx_frame_dump_write(&header, sizeof(header)) < 0 ||
+        zmk_rgb_fx_frame_dump_write(out_buffer, sizeof(out_buffer)) < 0) {
+        return -EIO;
+    }
+
+    return 0;
+}
+
+/**
+ * Opens the golden dump and checks that it was rendered with the same pixels and frame rate.
+ */
+static int rgb_fx_frame_dump_open_golden(const struct rgb_fx_frame_dump_header *header) {
+    struct rgb_fx_frame_dump_header golden;
+    struct rgb_fx_pixel_position golden_positions[RGB_FX_NUM_PIXELS];
+
+    if (zmk_rgb_fx_frame_dump_open_golden(golden_path) < 0) {
+        printk("rgb_fx_dump: failed to open %s\n", golden_path);
+        return -EIO;
+    }
+
+    if (zmk_rgb_fx_frame_dump_read_golden(&golden, sizeof(golden)) < 0 ||
+        memcmp(&golden, header, sizeof(golden)) != 0 ||
+        zmk_rgb_fx_frame_dump_read_golden(golden_positions, sizeof(golden_positions)) < 0 ||
+        memcmp(golden_positions, rgb_fx_pixel_positions, sizeof(golden_positions)) != 0) {
+        printk("rgb_fx_dump: %s was rendered with a different layout or frame rate\n",
+               golden_path);
+        zmk_rgb_fx_frame_dump_close_golden();
+        return -EINVAL;
+    }
+
+    return 0;
+}
+
+/**
+ * Compares the converted frame against the next frame of the golden dump.
+ *
+ * @return True if the frame was rendered at the same time and every channel is within
+ *         the tolerance
+ */
+static bool rgb_fx_frame_dump_check_golden(uint32_t frame_idx, uint32_t time_ms) {
+    struct rgb_fx_frame_dump_frame header;
+
+    if (zmk_rgb_fx_frame_dump_read_golden(&header, sizeof(header)) < 0 ||
+        zmk_rgb_fx_frame_dump_read_golden(golden_buffer, sizeof(golden_buffer)) < 0) {
+        printk("rgb_fx_dump: frame %u is missing from %s\n", frame_idx, golden_path);
+        return false;
+    }
+
+    if (header.time_ms != time_ms) {
+        printk("rgb_fx_dump: frame %u was rendered at %u ms, but at %u ms in %s\n", frame_idx,
+               time_ms, header.time_ms, golden_path);
+        return false;
+    }
+
+    size_t mismatches = 0;
+    uint8_t max_diff = 0;
+
+    for (size_t i = 0; i < sizeof(out_buffer); ++i) {
+        const uint8_t diff = out_buffer[i] > golden_buffer[i] ? out_buffer[i] - golden_buffer[i]
+                                                              : golden_buffer[i] - out_buffer[i];
+
+        if (diff > golden_tolerance) {
+            mismatches++;
+        }
+
+        max_diff = MAX(max_diff, diff);
+    }
+
+    if (mismatches > 0) {
+        printk("rgb_fx_dump: frame %u differs from %s in %u channels, by up to %u\n", frame_idx,
+               golden_path, (uint32_t)mismatches, max_diff);
+        return false;
+    }
+
+    return true;
+}
+
+void zmk_rgb_fx_frame_dump_begin_frame(void) {
+    frame_start_ns = zmk_rgb_fx_frame_dump_host_ns();
+    frame_start_ops = zmk_rgb_fx_get_op_count();
+}
+
+void zmk_rgb_fx_frame_dump_end_frame(const struct led_rgb *pixels, size_t num_pixels) {
+    const uint32_t render_ns = (uint32_t)(zmk_rgb_fx_frame_dump_host_ns() - frame_start_ns);
+    const uint32_t render_ops = zmk_rgb_fx_get_op_count() - frame_start_ops;
+    const uint32_t time_ms = (uint32_t)(k_uptime_get() - start_ms);
+
+    if (!atomic_get(&recording) || time_ms >= duration_ms) {
+        return;
+    }
+
+    rgb_fx_frame_dump_convert(pixels, MIN(num_pixels, RGB_FX_NUM_PIXELS));
+
+    bool passed = !check_golden || rgb_fx_frame_dump_check_golden(frame_count, time_ms);
+
+    if (budget_ops > 0 && render_ops > budget_ops) {
+        printk("rgb_fx_dump: frame %u took %u operations, over the budget of %u\n", frame_count,
+               render_ops, budget_ops);
+        passed = false;
+    }
+
+    if (!passed) {
+        failed_frames++;
+    }
+
+    if (rgb_fx_frame_dump_write_frame(time_ms, render_ns) < 0) {
+        printk("rgb_fx_dump: failed to write frame %u\n", frame_count);
+        write_error = -EIO;
+        atomic_clear(&recording);
+        return;
+    }
+
+    printk("rgb_fx_dump: %8u %8u %10u %10u\n", frame_count, time_ms, render_ns, render_ops);
+
+    frame_count++;
+    total_ns += render_ns;
+    max_ns = MAX(max_ns, render_ns);
+    max_ops = MAX(max_ops, render_ops);
+}
+
+static int rgb_fx_frame_dump_start(void) {
+    const struct rgb_fx_frame_dump_header header = {
+        .magic = FRAME_DUMP_MAGIC,
+        .version = FRAME_DUMP_VERSION,
+        .num_pixels = RGB_FX_NUM_PIXELS,
+        .fps = CONFIG_ZMK_RGB_FX_FPS,
+    };
+
+    if (rgb_fx_frame_dump_check_keys(dump_keys) < 0) {
+        printk("rgb_fx_dump: malformed key timeline \"%s\"\n", dump_keys);
+        return -EINVAL;
+    }
+
+    check_golden = golden_path[0] != '\0';
+
+    if (check_golden && strcmp(golden_path, dump_path) == 0) {
+        printk("rgb_fx_dump: the dump would overwrite the golden frames in %s\n", golden_path);
+        return -EINVAL;
+    }
+
+    if (check_golden && rgb_fx_frame_dump_open_golden(&header) < 0) {
+        return -EINVAL;
+    }
+
+    if (zmk_rgb_fx_frame_dump_open(dump_path) < 0) {
+        printk("rgb_fx_dump: failed to open %s\n", dump_path);
+        zmk_rgb_fx_frame_dump_close_golden();
+        return -EIO;
+    }
+
+    if (zmk_rgb_fx_frame_dump_write(&header, sizeof(header)) < 0 ||
+        zmk_rgb_fx_frame_dump_write(rgb_fx_pixel_positions, sizeof(rgb_fx_pixel_positions)) <
+            0) {
+        zmk_rgb_fx_frame_dump_close();
+        zmk_rgb_fx_frame_dump_close_golden();
+        return -EIO;
+    }
+
+    duration_ms = dump_frames * (1000 / CONFIG_ZMK_RGB_FX_FPS);
+
+    printk("rgb_fx_dump: %u ms of %u pixels to %s\n", duration_ms, (uint32_t)RGB_FX_NUM_PIXELS,
+           dump_path);
+    printk("rgb_fx_dump: %8s %8s %10s %10s\n", "frame", "ms", "render ns", "ops");
+
+    start_ms = k_uptime_get();
+    atomic_set(&recording, 1);
+
+    return 0;
+}
+
+/**
+ * Raises the key events of the timeline at their time while the animation renders,
+ * so timers, work items and the uptime advance just like on a keyboard.
+ */
+static void rgb_fx_frame_dump_play(void) {
+    uint32_t time_ms = 0;
+
+    while (rgb_fx_frame_dump_next_key(dump_keys, time_ms, &time_ms) && time_ms < duration_ms) {
+        k_sleep(K_TIMEOUT_ABS_MS(start_ms + time_ms));
+
+        rgb_fx_frame_dump_raise_keys(dump_keys, time_ms);
+
+        time_ms++;
+    }
+
+    k_sleep(K_TIMEOUT_ABS_MS(start_ms + duration_ms));
+}
+
+static int rgb_fx_frame_dump_finish(void) {
+    atomic_clear(&recording);
+
+    if (frame_count > 0) {
+        printk("rgb_fx_dump: %u frames, avg %u ns, max %u ns, frame budget %u ns\n",
+               frame_count, (uint32_t)(total_ns / frame_count), max_ns,
+               1000000000 / CONFIG_ZMK_RGB_FX_FPS);
+        printk("rgb_fx_dump: max %u operations per frame\n", max_ops);
+    }
+
+    struct rgb_fx_frame_dump_frame extra;
+
+    if (check_golden && write_error == 0 &&
+        zmk_rgb_fx_frame_dump_read_golden(&extra, sizeof(extra)) == 0) {
+        printk("rgb_fx_dump: %s has more frames than were rendered\n", golden_path);
+        failed_frames++;
+    }
+
+    zmk_rgb_fx_frame_dump_close_golden();
+
+    if (zmk_rgb_fx_frame_dump_close() < 0 || write_error < 0) {
+        return -EIO;
+    }
+
+    if (failed_frames > 0) {
+        printk("rgb_fx_dump: %u of %u frames failed\n", failed_frames, frame_count);
+        return -EINVAL;
+    }
+
+    return 0;
+}
+
+static void rgb_fx_frame_dump_thread(void *p1, void *p2, void *p3) {
+    int err = rgb_fx_frame_dump_start();
+
+    if (err == 0) {
+        rgb_fx_frame_dump_play();
+
+        err = rgb_fx_frame_dump_finish();
+    }
+
+    posix_exit(err < 0 ? 1 : 0);
+}
+
+K_THREAD_DEFINE(zmk_rgb_fx_frame_dump_thread_id, CONFIG_ZMK_RGB_FX_FRAME_DUMP_STACK_SIZE,
+                rgb_fx_frame_dump_thread, NULL, NULL, NULL, 0, 0, 0);
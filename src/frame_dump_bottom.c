@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) 2024 Kuba Birecki
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+/**
+ * Host side of the RGB FX frame dump for native_sim.
+ * This file is compiled against the host's C library.
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <time.h>
+
+static FILE *dump_file = NULL;
+static FILE *golden_file = NULL;
+
+uint64_t zmk_rgb_fx_frame_dump_host_ns(void) {
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return (uint64_t)ts.tv_sec * 1000000000 + (uint64_t)ts.tv_nsec;
+}
+
+int zmk_rgb_fx_frame_dump_open(const char *path) {
+    dump_file = fopen(path, "wb");
+
+    return dump_file == NULL ? -1 : 0;
+}
+
+int zmk_rgb_fx_frame_dump_write(const void *data, size_t len) {
+    if (dump_file == NULL || fwrite(data, 1, len, dump_file) != len) {
+        return -1;
+    }
+
+    return 0;
+}
+
+int zmk_rgb_fx_frame_dump_close(void) {
+    if (dump_file == NULL) {
+        return 0;
+    }
+
+    const int err = fclose(dump_file);
+
+    dump_file = NULL;
+
+    return err == 0 ? 0 : -1;
+}
+
+int zmk_rgb_fx_frame_dump_open_golden(const char *path) {
+    golden_file = fopen(path, "rb");
+
+    return golden_file == NULL ? -1 : 0;
+}
+
+int zmk_rgb_fx_frame_dump_read_golden(void *data, size_t len) {
+    if (golden_file == NULL || fread(data, 1, len, golden_file) != len) {
+        return -1;
+    }
+
+    return 0;
+}
+
+int zmk_rgb_fx_frame_dump_close_golden(void) {
+    if (golden_file == NULL) {
+        return 0;
+    }
+
+    const int err = fclose(golden_file);
+
+    golden_file = NULL;
+
+    return err == 0 ? 0 : -1;
+}
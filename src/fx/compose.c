@@ -16,19 +16,103 @@
 
 LOG_MODULE_DECLARE(zmk, CONFIG_ZMK_LOG_LEVEL);
 
-#define PHANDLE_TO_DEVICE(node_id, prop, idx) DEVICE_DT_GET(DT_PHANDLE_BY_IDX(node_id, prop, idx)),
+#define FX_COMPOSE_NUM_PIXELS DT_PROP_LEN(DT_INST(0, zmk_rgb_fx), pixels)
+
+/**
+ * Effects which overwrite every pixel they cover, regardless of what was rendered below them.
+ */
+#define FX_COMPOSE_IS_OPAQUE(node_id)                                                              \
+    (DT_NODE_HAS_COMPAT(node_id, zmk_rgb_fx_solid) ||                                              \
+     ((DT_NODE_HAS_COMPAT(node_id, zmk_rgb_fx_static) ||                                           \
+       DT_NODE_HAS_COMPAT(node_id, zmk_rgb_fx_linear_gradient) ||                                  \
+       DT_NODE_HAS_COMPAT(node_id, zmk_rgb_fx_sparkle) ||                                          \
+       DT_NODE_HAS_COMPAT(node_id, zmk_rgb_fx_wpm)) &&                                             \
+      DT_ENUM_IDX_OR(node_id, blending_mode, -1) == ZMK_RGB_FX_BLENDING_MODE_NORMAL))
+
+#define FX_COMPOSE_LAYER_PIXELS(node_id, prop, idx, inst)                                          \
+    COND_CODE_1(DT_NODE_HAS_PROP(DT_PHANDLE_BY_IDX(node_id, prop, idx), pixels),                   \
+                (static const zmk_rgb_fx_pixel_idx_t fx_compose_##inst##_layer_##idx##_pixels[] =  \
+                     DT_PROP(DT_PHANDLE_BY_IDX(node_id, prop, idx), pixels);),                     \
+                ())
+
+#define FX_COMPOSE_LAYER(node_id, prop, idx, inst)                                                 \
+    {                                                                                              \
+        .fx = DEVICE_DT_GET(DT_PHANDLE_BY_IDX(node_id, prop, idx)),                                \
+        .pixel_map = COND_CODE_1(DT_NODE_HAS_PROP(DT_PHANDLE_BY_IDX(node_id, prop, idx), pixels),  \
+                                 (fx_compose_##inst##_layer_##idx##_pixels), (NULL)),              \
+        .pixel_map_size = DT_PROP_LEN_OR(DT_PHANDLE_BY_IDX(node_id, prop, idx), pixels, 0),        \
+        .opaque = FX_COMPOSE_IS_OPAQUE(DT_PHANDLE_BY_IDX(node_id, prop, idx)),                     \
+    },
+
+struct fx_compose_layer {
+    const struct device *fx;
+    const zmk_rgb_fx_pixel_idx_t *pixel_map;
+    size_t pixel_map_size;
+    bool opaque;
+};
 
 struct fx_compose_config {
-    const struct device **fx;
+    const struct fx_compose_layer *layers;
     const size_t fx_size;
+    bool *hidden;
 };
 
-static void fx_compose_render_frame(const struct device *dev, struct rgb_fx_pixel *pixels,
-                                    size_t num_pixels) {
+static void fx_compose_render_frame(const struct device *dev, const struct rgb_fx_frame *frame,
+                                    uint32_t delta_ms) {
     const struct fx_compose_config *config = dev->config;
 
     for (size_t i = 0; i < config->fx_size; ++i) {
-        rgb_fx_render_frame(config->fx[i], pixels, num_pixels);
+        // Hidden layers only need to keep their animation going.
+        if (config->hidden[i]) {
+            rgb_fx_skip_frame(config->layers[i].fx, delta_ms);
+            continue;
+        }
+
+        rgb_fx_render_frame(config->layers[i].fx, frame, delta_ms);
+    }
+}
+
+#if IS_ENABLED(CONFIG_ZMK_RGB_FX_STATIC_GRAPH)
+/**
+ * Renders a layer through the generated render function of its effect,
+ * so the call is direct instead of going through the effect API.
+ */
+static ALWAYS_INLINE void fx_compose_render_layer(const struct device *dev, size_t i,
+                                                  void (*render)(const struct rgb_fx_frame *frame,
+                                                                 uint32_t delta_ms),
+                                                  const struct rgb_fx_frame *frame,
+                                                  uint32_t delta_ms) {
+    const struct fx_compose_config *config = dev->config;
+
+    if (config->hidden[i]) {
+        rgb_fx_skip_frame(config->layers[i].fx, delta_ms);
+        return;
+    }
+
+    render(frame, delta_ms);
+}
+
+#define FX_COMPOSE_RENDER_LAYER(node_id, prop, idx)                                                \
+    fx_compose_render_layer(dev, idx, RGB_FX_DT_RENDER_FN(DT_PHANDLE_BY_IDX(node_id, prop, idx)),  \
+                            frame, delta_ms);
+
+/**
+ * Unrolls the layers of a compose instance into a sequence of direct calls.
+ */
+#define FX_COMPOSE_STATIC_RENDER(idx)                                                              \
+    DT_INST_FOREACH_PROP_ELEM(idx, fx, RGB_FX_DT_DECLARE_RENDER_BY_IDX)                            \
+                                                                                                   \
+    static void fx_compose_##idx##_render(const struct device *dev,                                \
+                                          const struct rgb_fx_frame *frame, uint32_t delta_ms) {   \
+        DT_INST_FOREACH_PROP_ELEM(idx, fx, FX_COMPOSE_RENDER_LAYER)                                \
+    }
+#endif
+
+static void fx_compose_skip_frame(const struct device *dev, uint32_t delta_ms) {
+    const struct fx_compose_config *config = dev->config;
+
+    for (size_t i = 0; i < config->fx_size; ++i) {
+        rgb_fx_skip_frame(config->layers[i].fx, delta_ms);
     }
 }
 
@@ -36,7 +120,7 @@ static void fx_compose_start(const struct device *dev) {
     const struct fx_compose_config *config = dev->config;
 
     for (size_t i = 0; i < config->fx_size; ++i) {
-        rgb_fx_start(config->fx[i]);
+        rgb_fx_start(config->layers[i].fx);
     }
 }
 
@@ -44,30 +128,85 @@ static void fx_compose_stop(const struct device *dev) {
     const struct fx_compose_config *config = dev->config;
 
     for (size_t i = 0; i < config->fx_size; ++i) {
-        rgb_fx_stop(config->fx[i]);
+        rgb_fx_stop(config->layers[i].fx);
+    }
+}
+
+static bool fx_compose_is_dirty(const struct device *dev) {
+    const struct fx_compose_config *config = dev->config;
+
+    for (size_t i = 0; i < config->fx_size; ++i) {
+        if (!config->hidden[i] && rgb_fx_is_dirty(config->layers[i].fx)) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+static bool fx_compose_is_covered(const struct fx_compose_layer *layer, const bool *covered) {
+    for (size_t i = 0; i < layer->pixel_map_size; ++i) {
+        if (!covered[layer->pixel_map[i]]) {
+            return false;
+        }
     }
+
+    return true;
 }
 
-static int fx_compose_init(const struct device *dev) { return 0; }
+static int fx_compose_init(const struct device *dev) {
+    const struct fx_compose_config *config = dev->config;
+
+    // The layers never change, so the occlusion is resolved once instead of on every frame.
+    bool covered[FX_COMPOSE_NUM_PIXELS] = {false};
+
+    for (size_t i = config->fx_size; i-- > 0;) {
+        const struct fx_compose_layer *layer = &config->layers[i];
+
+        config->hidden[i] = layer->pixel_map_size > 0 && fx_compose_is_covered(layer, covered) &&
+                            rgb_fx_can_skip_frame(layer->fx);
+
+        if (!layer->opaque) {
+            continue;
+        }
+
+        for (size_t j = 0; j < layer->pixel_map_size; ++j) {
+            covered[layer->pixel_map[j]] = true;
+        }
+    }
+
+    return 0;
+}
 
 static const struct rgb_fx_api fx_compose_api = {
     .on_start = fx_compose_start,
     .on_stop = fx_compose_stop,
     .render_frame = fx_compose_render_frame,
+    .is_dirty = fx_compose_is_dirty,
+    .skip_frame = fx_compose_skip_frame,
 };
 
 #define FX_COMPOSE_DEVICE(idx)                                                                     \
                                                                                                    \
-    static const struct device *fx_compose_##idx##_fx[] = {                                        \
-        DT_INST_FOREACH_PROP_ELEM(idx, fx, PHANDLE_TO_DEVICE)};                                    \
+    DT_INST_FOREACH_PROP_ELEM_VARGS(idx, fx, FX_COMPOSE_LAYER_PIXELS, idx)                         \
+                                                                                                   \
+    static const struct fx_compose_layer fx_compose_##idx##_layers[] = {                           \
+        DT_INST_FOREACH_PROP_ELEM_VARGS(idx, fx, FX_COMPOSE_LAYER, idx)};                          \
+                                                                                                   \
+    static bool fx_compose_##idx##_hidden[DT_INST_PROP_LEN(idx, fx)];                              \
                                                                                                    \
     static struct fx_compose_config fx_compose_##idx##_config = {                                  \
-        .fx = fx_compose_##idx##_fx,                                                               \
+        .layers = fx_compose_##idx##_layers,                                                       \
         .fx_size = DT_INST_PROP_LEN(idx, fx),                                                      \
+        .hidden = fx_compose_##idx##_hidden,                                                       \
     };                                                                                             \
                                                                                                    \
+    IF_ENABLED(CONFIG_ZMK_RGB_FX_STATIC_GRAPH, (FX_COMPOSE_STATIC_RENDER(idx)))                    \
+                                                                                                   \
     DEVICE_DT_INST_DEFINE(idx, &fx_compose_init, NULL, NULL,                                       \
                           &fx_compose_##idx##_config, POST_KERNEL,                                 \
-                          CONFIG_APPLICATION_INIT_PRIORITY, &fx_compose_api);
+                          CONFIG_APPLICATION_INIT_PRIORITY, &fx_compose_api);                      \
+                                                                                                   \
+    RGB_FX_DT_INST_DEFINE_RENDER(idx, fx_compose_##idx##_render)
 
 DT_INST_FOREACH_STATUS_OKAY(FX_COMPOSE_DEVICE);
@@ -39,8 +39,22 @@ struct fx_control_group_data {
     bool active;
     uint8_t brightness;
     size_t current_fx_idx;
+
+    // Runtime state, not persisted in settings.
+    bool dirty;
+
+    /**
+     * Held while a frame is rendered and while a command is applied, so commands take effect
+     * in between frames.
+     */
+    struct k_mutex lock;
 };
 
+/**
+ * Only the fields preceding the runtime state are persisted in settings.
+ */
+#define FX_CONTROL_GROUP_SETTINGS_SIZE offsetof(struct fx_control_group_data, dirty)
+
 static int fx_control_group_load_settings(const struct device *dev, const char *name, size_t len,
                                           settings_read_cb read_cb, void *cb_arg) {
 #if IS_ENABLED(CONFIG_SETTINGS)
@@ -48,11 +62,11 @@ static int fx_control_group_load_settings(const struct device *dev, const char *
     int rc;
 
     if (settings_name_steq(name, "state", &next) && !next) {
-        if (len != sizeof(struct fx_control_group_data)) {
+        if (len != FX_CONTROL_GROUP_SETTINGS_SIZE) {
             return -EINVAL;
         }
 
-        rc = read_cb(cb_arg, dev->data, sizeof(struct fx_control_group_data));
+        rc = read_cb(cb_arg, dev->data, FX_CONTROL_GROUP_SETTINGS_SIZE);
         if (rc >= 0) {
             return 0;
         }
@@ -72,11 +86,14 @@ static void fx_control_group_save_work(struct k_work *work) {
     struct fx_control_group_work_context *ctx = CONTAINER_OF(dwork, struct fx_control_group_work_context, save_work);
 
     const struct device *dev = ctx->control_group;
+    struct fx_control_group_data *data = dev->data;
 
     char path[40];
     snprintf(path, 40, "%s/state", dev->name);
 
-    settings_save_one(path, dev->data, sizeof(struct fx_control_group_data));
+    k_mutex_lock(&data->lock, K_FOREVER);
+    settings_save_one(path, dev->data, FX_CONTROL_GROUP_SETTINGS_SIZE);
+    k_mutex_unlock(&data->lock);
 };
 
 static int fx_control_group_save_settings(const struct device *dev) {
@@ -85,11 +102,13 @@ static int fx_control_group_save_settings(const struct device *dev) {
 
     k_work_cancel_delayable(&ctx->save_work);
 
-    return k_work_reschedule(&ctx->save_work, K_MSEC(CONFIG_ZMK_SETTINGS_SAVE_DEBOUNCE));
+    return k_work_reschedule_for_queue(zmk_rgb_fx_work_q(), &ctx->save_work,
+                                       K_MSEC(CONFIG_ZMK_SETTINGS_SAVE_DEBOUNCE));
 }
 #endif /* IS_ENABLED(CONFIG_SETTINGS) */
 
-int zmk_rgb_fx_control_handle_command(const struct device *dev, uint8_t command, uint8_t param) {
+static void fx_control_group_apply_command(const struct device *dev, uint8_t command,
+                                          uint8_t param) {
     const struct fx_control_group_config *config = dev->config;
     struct fx_control_group_data *data = dev->data;
 
@@ -119,15 +138,11 @@ int zmk_rgb_fx_control_handle_command(const struct device *dev, uint8_t command,
         data->current_fx_idx--;
         break;
     case RGB_FX_CMD_SELECT:
-        if (config->fx_size < param) {
-            return -ENOTSUP;
-        }
-
         data->current_fx_idx = param;
         break;
     case RGB_FX_CMD_DIM:
         if (data->brightness == 0) {
-            return 0;
+            return;
         }
 
         data->brightness--;
@@ -138,7 +153,7 @@ int zmk_rgb_fx_control_handle_command(const struct device *dev, uint8_t command,
         break;
     case RGB_FX_CMD_BRIGHTEN:
         if (data->brightness == config->brightness_steps) {
-            return 0;
+            return;
         }
 
         if (data->brightness == 0) {
@@ -154,38 +169,126 @@ int zmk_rgb_fx_control_handle_command(const struct device *dev, uint8_t command,
 #endif /* IS_ENABLED(CONFIG_SETTINGS) */
 
     // Force refresh
+    data->dirty = true;
     zmk_rgb_fx_request_frames(1);
+}
+
+int zmk_rgb_fx_control_handle_command(const struct device *dev, uint8_t command, uint8_t param) {
+    const struct fx_control_group_config *config = dev->config;
+    struct fx_control_group_data *data = dev->data;
+
+    if (command == RGB_FX_CMD_SELECT && config->fx_size <= param) {
+        return -ENOTSUP;
+    }
+
+    // Waits for a frame being rendered to finish, so the effects don't change halfway through.
+    k_mutex_lock(&data->lock, K_FOREVER);
+    fx_control_group_apply_command(dev, command, param);
+    k_mutex_unlock(&data->lock);
 
     return 0;
 }
 
-static void fx_control_group_render_frame(const struct device *dev, struct rgb_fx_pixel *pixels,
-                                          size_t num_pixels) {
+/**
+ * Starts a frame, returning false if the group is off and nothing should be rendered.
+ * Otherwise the group stays locked until fx_control_group_end_frame().
+ */
+static bool fx_control_group_begin_frame(const struct device *dev) {
+    struct fx_control_group_data *data = dev->data;
+
+    k_mutex_lock(&data->lock, K_FOREVER);
+
+    data->dirty = false;
+
+    if (!data->active) {
+        k_mutex_unlock(&data->lock);
+        return false;
+    }
+
+    return true;
+}
+
+/**
+ * Applies the brightness to the rendered frame and unlocks the group.
+ */
+static void fx_control_group_end_frame(const struct device *dev, const struct rgb_fx_frame *frame) {
+    const struct fx_control_group_config *config = dev->config;
+    struct fx_control_group_data *data = dev->data;
+
+    if (data->brightness != config->brightness_steps) {
+        zmk_color_fraction_t brightness =
+            ZMK_COLOR_FRACTION(data->brightness, config->brightness_steps);
+
+        zmk_scale_span(frame->colors, frame->num_pixels, brightness);
+    }
+
+    k_mutex_unlock(&data->lock);
+}
+
+static void fx_control_group_render_frame(const struct device *dev,
+                                          const struct rgb_fx_frame *frame, uint32_t delta_ms) {
     const struct fx_control_group_config *config = dev->config;
     const struct fx_control_group_data *data = dev->data;
 
-    if (!data->active) {
+    if (!fx_control_group_begin_frame(dev)) {
         return;
     }
 
-    rgb_fx_render_frame(config->fx[data->current_fx_idx], pixels, num_pixels);
+    rgb_fx_render_frame(config->fx[data->current_fx_idx], frame, delta_ms);
 
-    if (data->brightness == config->brightness_steps) {
-        return;
+    fx_control_group_end_frame(dev, frame);
+}
+
+#if IS_ENABLED(CONFIG_ZMK_RGB_FX_STATIC_GRAPH)
+#define FX_CONTROL_GROUP_RENDER_CASE(node_id, prop, idx)                                           \
+    case idx:                                                                                      \
+        RGB_FX_DT_RENDER_FN(DT_PHANDLE_BY_IDX(node_id, prop, idx))(frame, delta_ms);               \
+        break;
+
+/**
+ * Switches between the effects of a control group instance with direct calls
+ * to their generated render functions.
+ */
+#define FX_CONTROL_GROUP_STATIC_RENDER(idx)                                                        \
+    DT_INST_FOREACH_PROP_ELEM(idx, fx, RGB_FX_DT_DECLARE_RENDER_BY_IDX)                            \
+                                                                                                   \
+    static void fx_control_group_##idx##_render(const struct device *dev,                          \
+                                                const struct rgb_fx_frame *frame,                  \
+                                                uint32_t delta_ms) {                               \
+        const struct fx_control_group_data *data = dev->data;                                      \
+                                                                                                   \
+        if (!fx_control_group_begin_frame(dev)) {                                                  \
+            return;                                                                                \
+        }                                                                                          \
+                                                                                                   \
+        switch (data->current_fx_idx) {                                                            \
+            DT_INST_FOREACH_PROP_ELEM(idx, fx, FX_CONTROL_GROUP_RENDER_CASE)                       \
+        }                                                                                          \
+                                                                                                   \
+        fx_control_group_end_frame(dev, frame);                                                    \
     }
+#endif
+
+static void fx_control_group_skip_frame(const struct device *dev, uint32_t delta_ms) {
+    const struct fx_control_group_config *config = dev->config;
+    struct fx_control_group_data *data = dev->data;
+
+    k_mutex_lock(&data->lock, K_FOREVER);
 
-    float brightness = (float)data->brightness / (float)config->brightness_steps;
+    data->dirty = false;
 
-    for (size_t i = 0; i < num_pixels; ++i) {
-        pixels[i].value.r *= brightness;
-        pixels[i].value.g *= brightness;
-        pixels[i].value.b *= brightness;
+    if (data->active) {
+        rgb_fx_skip_frame(config->fx[data->current_fx_idx], delta_ms);
     }
+
+    k_mutex_unlock(&data->lock);
 }
 
 static void fx_control_group_start(const struct device *dev) {
     const struct fx_control_group_config *config = dev->config;
-    const struct fx_control_group_data *data = dev->data;
+    struct fx_control_group_data *data = dev->data;
+
+    data->dirty = true;
 
     if (!data->active) {
         return;
@@ -202,6 +305,10 @@ static void fx_control_group_stop(const struct device *dev) {
 }
 
 static int fx_control_group_init(const struct device *dev) {
+    struct fx_control_group_data *data = dev->data;
+
+    k_mutex_init(&data->lock);
+
 #if IS_ENABLED(CONFIG_SETTINGS)
     const struct fx_control_group_config *config = dev->config;
 
@@ -217,10 +324,26 @@ static int fx_control_group_init(const struct device *dev) {
     return 0;
 }
 
+static bool fx_control_group_is_dirty(const struct device *dev) {
+    const struct fx_control_group_config *config = dev->config;
+    struct fx_control_group_data *data = dev->data;
+
+    k_mutex_lock(&data->lock, K_FOREVER);
+
+    const bool dirty =
+        data->dirty || (data->active && rgb_fx_is_dirty(config->fx[data->current_fx_idx]));
+
+    k_mutex_unlock(&data->lock);
+
+    return dirty;
+}
+
 static const struct rgb_fx_api fx_control_group_api = {
     .on_start = fx_control_group_start,
     .on_stop = fx_control_group_stop,
     .render_frame = fx_control_group_render_frame,
+    .is_dirty = fx_control_group_is_dirty,
+    .skip_frame = fx_control_group_skip_frame,
 };
 
 #define FX_CONTROL_GROUP_DEVICE(idx)                                                               \
@@ -256,10 +379,15 @@ static const struct rgb_fx_api fx_control_group_api = {
         .active = true,                                                                            \
         .brightness = DT_INST_PROP(idx, brightness_steps) - 1,                                     \
         .current_fx_idx = 0,                                                                       \
+        .dirty = false,                                                                            \
     };                                                                                             \
                                                                                                    \
+    IF_ENABLED(CONFIG_ZMK_RGB_FX_STATIC_GRAPH, (FX_CONTROL_GROUP_STATIC_RENDER(idx)))              \
+                                                                                                   \
     DEVICE_DT_INST_DEFINE(idx, &fx_control_group_init, NULL, &fx_control_group_##idx##_data,       \
                           &fx_control_group_##idx##_config, POST_KERNEL,                           \
-                          CONFIG_APPLICATION_INIT_PRIORITY, &fx_control_group_api);
+                          CONFIG_APPLICATION_INIT_PRIORITY, &fx_control_group_api);                \
+                                                                                                   \
+    RGB_FX_DT_INST_DEFINE_RENDER(idx, fx_control_group_##idx##_render)
 
 DT_INST_FOREACH_STATUS_OKAY(FX_CONTROL_GROUP_DEVICE);
@@ -6,8 +6,6 @@
 
 #define DT_DRV_COMPAT zmk_rgb_fx_linear_gradient
 
-#include <math.h>
-
 #include <zephyr/device.h>
 #include <zephyr/kernel.h>
 #include <zephyr/logging/log.h>
@@ -18,74 +16,160 @@
 
 LOG_MODULE_DECLARE(zmk, CONFIG_ZMK_LOG_LEVEL);
 
+/**
+ * The gradient offset is stored with 16 fractional bits,
+ * so slow gradients still move by a non-zero amount every millisecond.
+ */
+#define FX_LINEAR_GRADIENT_OFFSET_SHIFT 16
+
+#define FX_LINEAR_GRADIENT_PI 3.14159265358979323846
+
+#define FX_LINEAR_GRADIENT_PIXEL_X(node_id, idx)                                                   \
+    DT_PHA_BY_IDX(DT_INST(0, zmk_rgb_fx), pixels, DT_PROP_BY_IDX(node_id, pixels, idx), position_x)
+
+#define FX_LINEAR_GRADIENT_PIXEL_Y(node_id, idx)                                                   \
+    DT_PHA_BY_IDX(DT_INST(0, zmk_rgb_fx), pixels, DT_PROP_BY_IDX(node_id, pixels, idx), position_y)
+
+/**
+ * Relying on properties of 2D graph rotation to calculate the distance for each pixel along the
+ * gradient axis: https://en.wikipedia.org/wiki/Rotation_of_axes_in_two_dimensions
+ *
+ * The angle is known at build time, so the compiler folds the whole expression into a constant.
+ */
+#define FX_LINEAR_GRADIENT_AXIS_DISTANCE(node_id, idx)                                             \
+    (FX_LINEAR_GRADIENT_PIXEL_X(node_id, idx) *                                                    \
+         __builtin_cos(DT_PROP(node_id, angle) * FX_LINEAR_GRADIENT_PI / 180) +                    \
+     FX_LINEAR_GRADIENT_PIXEL_Y(node_id, idx) *                                                    \
+         __builtin_sin(DT_PROP(node_id, angle) * FX_LINEAR_GRADIENT_PI / 180))
+
+/**
+ * Position of the pixel along the gradient, wrapped into the [0, gradient-width) range.
+ */
+#define FX_LINEAR_GRADIENT_PROJECTION(node_id, prop, idx)                                          \
+    (uint16_t)((uint16_t)(FX_LINEAR_GRADIENT_AXIS_DISTANCE(node_id, idx) -                         \
+                          __builtin_floor(FX_LINEAR_GRADIENT_AXIS_DISTANCE(node_id, idx) /         \
+                                          DT_PROP(node_id, gradient_width)) *                      \
+                              DT_PROP(node_id, gradient_width)) %                                  \
+               DT_PROP(node_id, gradient_width)),
+
 struct fx_linear_gradient_config {
     struct zmk_color_hsl *colors_hsl;
     struct zmk_color_rgb *colors_rgb;
-    size_t *pixel_map;
+    const zmk_rgb_fx_pixel_idx_t *pixel_map;
+    const uint16_t *projections;
     size_t pixel_map_size;
-    uint8_t blending_mode;
+    zmk_blend_span_t blend_span;
     uint8_t num_colors;
-    uint8_t angle;
     bool use_hsl;
     uint16_t gradient_width;
-    float offset_per_frame;
+    uint32_t offset_per_ms;
+    uint8_t fps;
+#if IS_ENABLED(CONFIG_ZMK_RGB_FX_LINEAR_GRADIENT_PALETTE)
+    struct zmk_color_rgb *palette;
+#endif
 };
 
 struct fx_linear_gradient_data {
-    float offset;
+    uint32_t offset;
+    bool dirty;
 };
 
-static void fx_linear_gradient_render_frame(const struct device *dev, struct rgb_fx_pixel *pixels,
-                                            size_t num_pixels) {
+/**
+ * Computes the gradient color at the given position along the gradient axis.
+ */
+static void fx_linear_gradient_color_at(const struct fx_linear_gradient_config *config,
+                                        uint16_t position, struct zmk_color_rgb *color) {
+    const uint32_t scaled_position = (uint32_t)position * config->num_colors;
+
+    const uint8_t from = scaled_position / config->gradient_width;
+    const uint8_t to = (from + 1) % config->num_colors;
+
+    const zmk_color_fraction_t step = ZMK_COLOR_FRACTION(
+        scaled_position - from * config->gradient_width, config->gradient_width);
+
+    if (config->use_hsl) {
+        struct zmk_color_hsl color_hsl;
+
+        zmk_interpolate_hsl(&config->colors_hsl[from], &config->colors_hsl[to], &color_hsl, step);
+        zmk_hsl_to_rgb(&color_hsl, color);
+    } else {
+        zmk_interpolate_rgb(&config->colors_rgb[from], &config->colors_rgb[to], color, step);
+    }
+}
+
+/**
+ * Moves the gradient by the elapsed time.
+ */
+static void fx_linear_gradient_advance(const struct device *dev, uint32_t delta_ms) {
     const struct fx_linear_gradient_config *config = dev->config;
     struct fx_linear_gradient_data *data = dev->data;
 
-    size_t *pixel_map = config->pixel_map;
+    data->dirty = false;
 
-    uint16_t color_width = config->gradient_width / config->num_colors;
+    if (config->offset_per_ms == 0) {
+        return;
+    }
 
-    for (size_t i = 0; i < config->pixel_map_size; ++i) {
-        // Relying on properties of 2D graph rotation to calculate the distance for each pixel along the gradient axis
-        // https://en.wikipedia.org/wiki/Rotation_of_axes_in_two_dimensions
-        float x = pixels[pixel_map[i]].position_x * cos(config->angle) + pixels[pixel_map[i]].position_y * sin(config->angle);
-        float distance = config->gradient_width + x - data->offset;
+    data->offset = ((uint64_t)data->offset + (uint64_t)config->offset_per_ms * delta_ms) %
+                   ((uint32_t)config->gradient_width << FX_LINEAR_GRADIENT_OFFSET_SHIFT);
 
-        while (distance >= config->gradient_width) { 
-            distance -= config->gradient_width;
-        }
+    zmk_rgb_fx_request_frames_at(1, config->fps);
+}
 
-        uint8_t from = distance / color_width;
-        uint8_t to = (from + 1) % config->num_colors;
+static ALWAYS_INLINE void fx_linear_gradient_draw(const struct device *dev,
+                                                   const struct rgb_fx_frame *frame,
+                                                   const zmk_rgb_fx_pixel_idx_t *pixel_map) {
+    const struct fx_linear_gradient_config *config = dev->config;
+    const struct fx_linear_gradient_data *data = dev->data;
 
-        float step = (float)(distance - (from * color_width)) / (float)color_width;
+    const uint16_t offset =
+        config->gradient_width - (data->offset >> FX_LINEAR_GRADIENT_OFFSET_SHIFT);
 
-        struct zmk_color_hsl color_hsl;
-        struct zmk_color_rgb color_rgb;
+    struct zmk_color_rgb span[ZMK_BLEND_SPAN_SIZE];
 
-        if (config->use_hsl) {
-            zmk_interpolate_hsl(&config->colors_hsl[from], &config->colors_hsl[to], &color_hsl, step);
-            zmk_hsl_to_rgb(&color_hsl, &color_rgb);
-        } else {
-            zmk_interpolate_rgb(&config->colors_rgb[from], &config->colors_rgb[to], &color_rgb, step);
-        }
+    for (size_t start = 0; start < config->pixel_map_size; start += ZMK_BLEND_SPAN_SIZE) {
+        const size_t count = MIN(config->pixel_map_size - start, ZMK_BLEND_SPAN_SIZE);
 
-        pixels[pixel_map[i]].value = zmk_apply_blending_mode(pixels[pixel_map[i]].value, color_rgb, config->blending_mode);
-    }
+        for (size_t i = 0; i < count; ++i) {
+            uint16_t position = config->projections[start + i] + offset;
 
-    if (config->offset_per_frame == 0) {
-        return;
+            if (position >= config->gradient_width) {
+                position -= config->gradient_width;
+            }
+
+#if IS_ENABLED(CONFIG_ZMK_RGB_FX_LINEAR_GRADIENT_PALETTE)
+            span[i] = config->palette[position];
+#else
+            fx_linear_gradient_color_at(config, position, &span[i]);
+#endif
+        }
+
+        rgb_fx_blend_span(config->blend_span, frame, pixel_map, start, span, count);
     }
+}
 
-    data->offset += config->offset_per_frame;
+static void fx_linear_gradient_render_frame(const struct device *dev,
+                                            const struct rgb_fx_frame *frame, uint32_t delta_ms) {
+    const struct fx_linear_gradient_config *config = dev->config;
 
-    if (data->offset > config->gradient_width) {
-        data->offset -= config->gradient_width;
+    if (config->pixel_map == NULL) {
+        fx_linear_gradient_draw(dev, frame, NULL);
+    } else {
+        fx_linear_gradient_draw(dev, frame, config->pixel_map);
     }
 
-    zmk_rgb_fx_request_frames(1);
+    fx_linear_gradient_advance(dev, delta_ms);
+}
+
+static void fx_linear_gradient_skip_frame(const struct device *dev, uint32_t delta_ms) {
+    fx_linear_gradient_advance(dev, delta_ms);
 }
 
 static void fx_linear_gradient_start(const struct device *dev) {
+    struct fx_linear_gradient_data *data = dev->data;
+
+    data->dirty = true;
+
     zmk_rgb_fx_request_frames(1);
 }
 
@@ -100,45 +184,75 @@ static int fx_linear_gradient_init(const struct device *dev) {
         zmk_hsl_to_rgb(&config->colors_hsl[i], &config->colors_rgb[i]);
     }
 
+#if IS_ENABLED(CONFIG_ZMK_RGB_FX_LINEAR_GRADIENT_PALETTE)
+    for (uint16_t i = 0; i < config->gradient_width; ++i) {
+        fx_linear_gradient_color_at(config, i, &config->palette[i]);
+    }
+#endif
+
     return 0;
 };
 
+static bool fx_linear_gradient_is_dirty(const struct device *dev) {
+    const struct fx_linear_gradient_config *config = dev->config;
+    const struct fx_linear_gradient_data *data = dev->data;
+
+    return data->dirty || config->offset_per_ms > 0;
+}
+
 static const struct rgb_fx_api fx_linear_gradient_api = {
     .on_start = fx_linear_gradient_start,
     .on_stop = fx_linear_gradient_stop,
     .render_frame = fx_linear_gradient_render_frame,
+    .is_dirty = fx_linear_gradient_is_dirty,
+    .skip_frame = fx_linear_gradient_skip_frame,
 };
 
 #define FX_LINEAR_GRADIENT_DEVICE(idx)                                                             \
                                                                                                    \
-    static size_t fx_linear_gradient_##idx##_pixel_map[] = DT_INST_PROP(idx, pixels);              \
+    static const zmk_rgb_fx_pixel_idx_t fx_linear_gradient_##idx##_pixel_map[] =                   \
+        DT_INST_PROP(idx, pixels);                                                                 \
+                                                                                                   \
+    static const uint16_t fx_linear_gradient_##idx##_projections[] = {                             \
+        DT_INST_FOREACH_PROP_ELEM(idx, pixels, FX_LINEAR_GRADIENT_PROJECTION)};                    \
                                                                                                    \
     static uint32_t fx_linear_gradient_##idx##_colors_hsl[] = DT_INST_PROP(idx, colors);           \
                                                                                                    \
     static struct zmk_color_rgb fx_linear_gradient_##idx##_colors_rgb[                             \
         DT_INST_PROP_LEN(idx, colors)];                                                            \
                                                                                                    \
+    IF_ENABLED(CONFIG_ZMK_RGB_FX_LINEAR_GRADIENT_PALETTE,                                          \
+               (static struct zmk_color_rgb                                                        \
+                    fx_linear_gradient_##idx##_palette[DT_INST_PROP(idx, gradient_width)];))       \
+                                                                                                   \
     static struct fx_linear_gradient_config fx_linear_gradient_##idx##_config = {                  \
         .colors_hsl = (struct zmk_color_hsl *)fx_linear_gradient_##idx##_colors_hsl,               \
         .colors_rgb = fx_linear_gradient_##idx##_colors_rgb,                                       \
         .num_colors = DT_INST_PROP_LEN(idx, colors),                                               \
-        .pixel_map = fx_linear_gradient_##idx##_pixel_map,                                         \
+        .pixel_map = RGB_FX_DT_INST_PIXEL_MAP(idx, fx_linear_gradient_##idx##_pixel_map),          \
+        .projections = fx_linear_gradient_##idx##_projections,                                     \
         .pixel_map_size = DT_INST_PROP_LEN(idx, pixels),                                           \
-        .blending_mode = DT_INST_ENUM_IDX(idx, blending_mode),                                     \
+        .blend_span = ZMK_BLEND_SPAN(DT_INST_STRING_TOKEN(idx, blending_mode)),                    \
         .use_hsl = !DT_INST_PROP(idx, use_rgb_interpolation),                                      \
         .gradient_width = DT_INST_PROP(idx, gradient_width),                                       \
-        .offset_per_frame = DT_INST_PROP(idx, duration) > 0                                        \
-            ? (float)DT_INST_PROP(idx, gradient_width) /                                           \
-                (float)(DT_INST_PROP(idx, duration) * CONFIG_ZMK_RGB_FX_FPS)                       \
+        .offset_per_ms = DT_INST_PROP(idx, duration) > 0                                           \
+            ? ((uint32_t)DT_INST_PROP(idx, gradient_width) << FX_LINEAR_GRADIENT_OFFSET_SHIFT) /   \
+                (DT_INST_PROP(idx, duration) * 1000)                                               \
             : 0,                                                                                   \
+        .fps = DT_INST_PROP_OR(idx, fps, 0),                                                       \
+        IF_ENABLED(CONFIG_ZMK_RGB_FX_LINEAR_GRADIENT_PALETTE,                                      \
+                   (.palette = fx_linear_gradient_##idx##_palette,))                               \
     };                                                                                             \
                                                                                                    \
     static struct fx_linear_gradient_data fx_linear_gradient_##idx##_data = {                      \
         .offset = 0,                                                                               \
+        .dirty = false,                                                                            \
     };                                                                                             \
                                                                                                    \
     DEVICE_DT_INST_DEFINE(idx, &fx_linear_gradient_init, NULL, &fx_linear_gradient_##idx##_data,   \
                           &fx_linear_gradient_##idx##_config, POST_KERNEL,                         \
-                          CONFIG_APPLICATION_INIT_PRIORITY, &fx_linear_gradient_api);
+                          CONFIG_APPLICATION_INIT_PRIORITY, &fx_linear_gradient_api);              \
+                                                                                                   \
+    RGB_FX_DT_INST_DEFINE_RENDER(idx, fx_linear_gradient_render_frame)
 
 DT_INST_FOREACH_STATUS_OKAY(FX_LINEAR_GRADIENT_DEVICE);
@@ -12,6 +12,7 @@
 #include <zephyr/device.h>
 #include <zephyr/kernel.h>
 #include <zephyr/logging/log.h>
+#include <zephyr/sys/atomic.h>
 
 #include <drivers/rgb_fx.h>
 
@@ -21,30 +22,46 @@
 
 LOG_MODULE_DECLARE(zmk, CONFIG_ZMK_LOG_LEVEL);
 
+/**
+ * The pixels of each event are grouped into buckets by their distance from the event origin,
+ * so rendering a ripple only visits the buckets overlapping its ring.
+ */
+#define FX_RIPPLE_BUCKET_SHIFT 4
+#define FX_RIPPLE_NUM_BUCKETS ((UINT8_MAX >> FX_RIPPLE_BUCKET_SHIFT) + 1)
+
 struct fx_ripple_event {
-    size_t pixel_id;
+    zmk_rgb_fx_pixel_idx_t pixel_id;
     uint16_t distance;
-    uint8_t counter;
+    uint32_t elapsed;
+    bool indexed;
+    uint16_t buckets[FX_RIPPLE_NUM_BUCKETS + 1];
 };
 
 struct fx_ripple_config {
     struct zmk_color_hsl *color_hsl;
-    size_t *pixel_map;
+    const zmk_rgb_fx_pixel_idx_t *pixel_map;
     size_t pixel_map_size;
+    uint16_t *event_pixels;
     size_t event_buffer_size;
     uint8_t blending_mode;
-    uint8_t distance_per_frame;
     uint8_t ripple_width;
-    uint8_t event_frames;
+    uint32_t duration;
+    uint8_t fps;
 };
 
+/**
+ * The event buffer is a single-producer/single-consumer ring. Key press listeners only ever
+ * advance events_end and the render path only advances events_start, so the two can run
+ * concurrently without locking. Both are free-running counters, the buffer slot is the counter
+ * modulo the buffer size and the number of pending events is their difference.
+ */
 struct fx_ripple_data {
     struct zmk_color_rgb color_rgb;
     struct fx_ripple_event *event_buffer;
-    size_t events_start;
-    size_t events_end;
-    size_t num_events;
+    atomic_t events_start;
+    atomic_t events_end;
     bool is_active;
+    bool dirty;
 };
 
 static int fx_ripple_on_key_press(const struct device *dev, const zmk_event_t *event) {
@@ -67,75 +84,184 @@ static int fx_ripple_on_key_press(const struct device *dev, const zmk_event_t *e
         return 0;
     }
 
-    if (data->num_events == config->event_buffer_size) {
+    const atomic_val_t events_end = atomic_get(&data->events_end);
+
+    if ((size_t)(events_end - atomic_get(&data->events_start)) >= config->event_buffer_size) {
         // Event buffer is full - new key press events are dropped.
         return -ENOMEM;
     }
 
-    data->event_buffer[data->events_end].pixel_id =
-        zmk_rgb_fx_get_pixel_by_key_position(pos_event->position);
-    data->event_buffer[data->events_end].distance = 0;
-    data->event_buffer[data->events_end].counter = 0;
+    struct fx_ripple_event *new_event =
+        &data->event_buffer[(size_t)events_end % config->event_buffer_size];
 
-    data->events_end = (data->events_end + 1) % config->event_buffer_size;
-    data->num_events += 1;
+    new_event->pixel_id = zmk_rgb_fx_get_pixel_by_key_position(pos_event->position);
+    new_event->distance = 0;
+    new_event->elapsed = 0;
+    new_event->indexed = false;
 
-    zmk_rgb_fx_request_frames(config->event_frames);
+    // Publish the event only once it's fully written.
+    atomic_set(&data->events_end, events_end + 1);
+
+    zmk_rgb_fx_request_frames_at(1, config->fps);
 
     return 0;
 }
 
-static void fx_ripple_render_frame(const struct device *dev, struct rgb_fx_pixel *pixels,
-                                   size_t num_pixels) {
+/**
+ * Sorts the pixel map indices into distance buckets relative to the event origin.
+ * The sorted indices are stored in the event's slice of event_pixels
+ * and the bucket boundaries in event->buckets.
+ */
+static void fx_ripple_index_event(const struct device *dev, size_t event_idx) {
     const struct fx_ripple_config *config = dev->config;
     struct fx_ripple_data *data = dev->data;
 
-    size_t *pixel_map = config->pixel_map;
+    struct fx_ripple_event *event = &data->event_buffer[event_idx];
+    uint16_t *event_pixels = &config->event_pixels[event_idx * config->pixel_map_size];
+    uint16_t offsets[FX_RIPPLE_NUM_BUCKETS] = {0};
 
-    size_t i = data->events_start;
+    for (size_t j = 0; j < config->pixel_map_size; ++j) {
+        const size_t px = rgb_fx_pixel_index(config->pixel_map, j);
 
-    while (i != data->events_end) {
-        struct fx_ripple_event *event = &data->event_buffer[i];
+        offsets[zmk_rgb_fx_get_pixel_distance(event->pixel_id, px) >> FX_RIPPLE_BUCKET_SHIFT]++;
+    }
 
-        // Render all pixels for each event
-        for (int j = 0; j < config->pixel_map_size; ++j) {
-            uint8_t pixel_distance =
-                zmk_rgb_fx_get_pixel_distance(event->pixel_id, pixel_map[j]);
+    event->buckets[0] = 0;
 
-            if (config->ripple_width > abs(pixel_distance - event->distance)) {
-                float intensity = 1.0f - (float)abs(pixel_distance - event->distance) /
-                                             (float)config->ripple_width;
+    for (size_t b = 0; b < FX_RIPPLE_NUM_BUCKETS; ++b) {
+        event->buckets[b + 1] = event->buckets[b] + offsets[b];
+        offsets[b] = event->buckets[b];
+    }
 
-                struct zmk_color_rgb color = {
-                    .r = intensity * data->color_rgb.r,
-                    .g = intensity * data->color_rgb.g,
-                    .b = intensity * data->color_rgb.b,
-                };
+    for (size_t j = 0; j < config->pixel_map_size; ++j) {
+        const size_t px = rgb_fx_pixel_index(config->pixel_map, j);
 
-                pixels[pixel_map[j]].value = zmk_apply_blending_mode(pixels[pixel_map[j]].value,
-                                                                     color, config->blending_mode);
-            }
-        }
+        uint8_t bucket =
+            zmk_rgb_fx_get_pixel_distance(event->pixel_id, px) >> FX_RIPPLE_BUCKET_SHIFT;
+
+        event_pixels[offsets[bucket]++] = j;
+    }
+}
 
-        // Update event counter
-        if (event->counter < config->event_frames) {
-            event->distance += config->distance_per_frame;
-            event->counter += 1;
+/**
+ * Advances the given range of events by the elapsed time and retires the finished ones.
+ */
+static void fx_ripple_advance(const struct device *dev, atomic_val_t events_start,
+                              atomic_val_t events_end, uint32_t delta_ms) {
+    const struct fx_ripple_config *config = dev->config;
+    struct fx_ripple_data *data = dev->data;
+
+    size_t finished_events = 0;
+
+    data->dirty = false;
+
+    for (atomic_val_t n = events_start; n != events_end; ++n) {
+        struct fx_ripple_event *event = &data->event_buffer[(size_t)n % config->event_buffer_size];
+
+        // The ring is rendered once more at the full distance before the event ends
+        if (event->elapsed < config->duration) {
+            event->elapsed = MIN(event->elapsed + delta_ms, config->duration);
         } else {
-            data->events_start = (data->events_start + 1) % config->event_buffer_size;
-            data->num_events -= 1;
+            finished_events += 1;
+
+            // The next frame has to clear the last ring of the event.
+            data->dirty = true;
         }
+    }
+
+    // Fails if the events were cancelled in the meantime, in which case there's nothing to retire.
+    atomic_cas(&data->events_start, events_start, events_start + finished_events);
+
+    if (data->dirty || finished_events < (size_t)(events_end - events_start)) {
+        zmk_rgb_fx_request_frames_at(1, config->fps);
+    }
+}
+
+/**
+ * Draws the pixels of the event's ring, given as a range of its sorted pixel indices.
+ */
+static ALWAYS_INLINE void fx_ripple_draw_ring(const struct device *dev,
+                                              const struct rgb_fx_frame *frame,
+                                              const struct fx_ripple_event *event,
+                                              const uint16_t *ring_start, const uint16_t *ring_end,
+                                              const zmk_rgb_fx_pixel_idx_t *pixel_map) {
+    const struct fx_ripple_config *config = dev->config;
+    const struct fx_ripple_data *data = dev->data;
+
+    for (const uint16_t *k = ring_start; k < ring_end; ++k) {
+        const size_t px = rgb_fx_pixel_index(pixel_map, *k);
+
+        uint8_t pixel_distance = zmk_rgb_fx_get_pixel_distance(event->pixel_id, px);
 
-        if (++i == config->event_buffer_size) {
-            i = 0;
+        if (config->ripple_width > abs(pixel_distance - event->distance)) {
+            zmk_color_fraction_t intensity =
+                ZMK_COLOR_FRACTION(config->ripple_width - abs(pixel_distance - event->distance),
+                                   config->ripple_width);
+
+            struct zmk_color_rgb color;
+
+            zmk_scale_rgb(&data->color_rgb, &color, intensity);
+
+            frame->colors[px] =
+                zmk_apply_blending_mode(frame->colors[px], color, config->blending_mode);
+        }
+    }
+}
+
+static void fx_ripple_render_frame(const struct device *dev, const struct rgb_fx_frame *frame,
+                                   uint32_t delta_ms) {
+    const struct fx_ripple_config *config = dev->config;
+    struct fx_ripple_data *data = dev->data;
+
+    const atomic_val_t events_start = atomic_get(&data->events_start);
+    const atomic_val_t events_end = atomic_get(&data->events_end);
+
+    for (atomic_val_t n = events_start; n != events_end; ++n) {
+        const size_t i = (size_t)n % config->event_buffer_size;
+
+        struct fx_ripple_event *event = &data->event_buffer[i];
+        const uint16_t *event_pixels = &config->event_pixels[i * config->pixel_map_size];
+
+        if (!event->indexed) {
+            fx_ripple_index_event(dev, i);
+            event->indexed = true;
+        }
+
+        event->distance = (uint64_t)event->elapsed * UINT8_MAX / config->duration;
+
+        // Only the buckets overlapping the ring need to be visited
+        const int first_bucket =
+            MAX(event->distance - config->ripple_width + 1, 0) >> FX_RIPPLE_BUCKET_SHIFT;
+        const int last_bucket =
+            MIN(event->distance + config->ripple_width - 1, UINT8_MAX) >> FX_RIPPLE_BUCKET_SHIFT;
+
+        const uint16_t ring_start = first_bucket <= last_bucket ? event->buckets[first_bucket] : 0;
+        const uint16_t ring_end = first_bucket <= last_bucket ? event->buckets[last_bucket + 1] : 0;
+
+        if (config->pixel_map == NULL) {
+            fx_ripple_draw_ring(dev, frame, event, &event_pixels[ring_start],
+                                &event_pixels[ring_end], NULL);
+        } else {
+            fx_ripple_draw_ring(dev, frame, event, &event_pixels[ring_start],
+                                &event_pixels[ring_end], config->pixel_map);
         }
     }
+
+    fx_ripple_advance(dev, events_start, events_end, delta_ms);
+}
+
+static void fx_ripple_skip_frame(const struct device *dev, uint32_t delta_ms) {
+    struct fx_ripple_data *data = dev->data;
+
+    fx_ripple_advance(dev, atomic_get(&data->events_start), atomic_get(&data->events_end),
+                      delta_ms);
 }
 
 static void fx_ripple_start(const struct device *dev) {
     struct fx_ripple_data *data = dev->data;
 
     data->is_active = true;
+    data->dirty = true;
 }
 
 static void fx_ripple_stop(const struct device *dev) {
@@ -144,9 +270,7 @@ static void fx_ripple_stop(const struct device *dev) {
     data->is_active = false;
 
     // Cancel processing of any ongoing events.
-    data->num_events = 0;
-    data->events_start = 0;
-    data->events_end = 0;
+    atomic_set(&data->events_start, atomic_get(&data->events_end));
 }
 
 static int fx_ripple_init(const struct device *dev) {
@@ -158,10 +282,18 @@ static int fx_ripple_init(const struct device *dev) {
     return 0;
 }
 
+static bool fx_ripple_is_dirty(const struct device *dev) {
+    const struct fx_ripple_data *data = dev->data;
+
+    return data->dirty || atomic_get(&data->events_start) != atomic_get(&data->events_end);
+}
+
 static const struct rgb_fx_api fx_ripple_api = {
     .on_start = fx_ripple_start,
     .on_stop = fx_ripple_stop,
     .render_frame = fx_ripple_render_frame,
+    .is_dirty = fx_ripple_is_dirty,
+    .skip_frame = fx_ripple_skip_frame,
 };
 
 #define FX_RIPPLE_DEVICE(idx)                                                                      \
@@ -171,32 +303,36 @@ static const struct rgb_fx_api fx_ripple_api = {
                                                                                                    \
     static struct fx_ripple_data fx_ripple_##idx##_data = {                                        \
         .event_buffer = fx_ripple_##idx##_events,                                                  \
-        .events_start = 0,                                                                         \
-        .events_end = 0,                                                                           \
-        .num_events = 0,                                                                           \
+        .events_start = ATOMIC_INIT(0),                                                            \
+        .events_end = ATOMIC_INIT(0),                                                              \
     };                                                                                             \
                                                                                                    \
-    static size_t fx_ripple_##idx##_pixel_map[] = DT_INST_PROP(idx, pixels);                       \
+    static const zmk_rgb_fx_pixel_idx_t fx_ripple_##idx##_pixel_map[] =                            \
+        DT_INST_PROP(idx, pixels);                                                                 \
+                                                                                                   \
+    static uint16_t fx_ripple_##idx##_event_pixels[DT_INST_PROP(idx, buffer_size) *                \
+                                                   DT_INST_PROP_LEN(idx, pixels)];                 \
                                                                                                    \
     static uint32_t fx_ripple_##idx##_color = DT_INST_PROP(idx, color);                            \
                                                                                                    \
     static struct fx_ripple_config fx_ripple_##idx##_config = {                                    \
         .color_hsl = (struct zmk_color_hsl *)&fx_ripple_##idx##_color,                             \
-        .pixel_map = &fx_ripple_##idx##_pixel_map[0],                                              \
+        .pixel_map = RGB_FX_DT_INST_PIXEL_MAP(idx, fx_ripple_##idx##_pixel_map),                   \
         .pixel_map_size = DT_INST_PROP_LEN(idx, pixels),                                           \
+        .event_pixels = fx_ripple_##idx##_event_pixels,                                            \
         .event_buffer_size = DT_INST_PROP(idx, buffer_size),                                       \
         .blending_mode = DT_INST_ENUM_IDX(idx, blending_mode),                                     \
-        .distance_per_frame =                                                                      \
-            (255 * 1000 / DT_INST_PROP(idx, duration)) / CONFIG_ZMK_RGB_FX_FPS,                    \
         .ripple_width = DT_INST_PROP(idx, ripple_width) / 2,                                       \
-        .event_frames =                                                                            \
-            255 / ((255 * 1000 / DT_INST_PROP(idx, duration)) / CONFIG_ZMK_RGB_FX_FPS),            \
+        .duration = DT_INST_PROP(idx, duration),                                                   \
+        .fps = DT_INST_PROP_OR(idx, fps, 0),                                                       \
     };                                                                                             \
                                                                                                    \
     DEVICE_DT_INST_DEFINE(idx, &fx_ripple_init, NULL, &fx_ripple_##idx##_data,                     \
                           &fx_ripple_##idx##_config, POST_KERNEL,                                  \
                           CONFIG_APPLICATION_INIT_PRIORITY, &fx_ripple_api);                       \
                                                                                                    \
+    RGB_FX_DT_INST_DEFINE_RENDER(idx, fx_ripple_render_frame)                                      \
+                                                                                                   \
     static int fx_ripple_##idx##_event_handler(const zmk_event_t *event) {                         \
         const struct device *dev = DEVICE_DT_GET(DT_DRV_INST(idx));                                \
                                                                                                    \
@@ -17,16 +17,21 @@
 LOG_MODULE_DECLARE(zmk, CONFIG_ZMK_LOG_LEVEL);
 
 struct fx_solid_config {
-    size_t *pixel_map;
+    const zmk_rgb_fx_pixel_idx_t *pixel_map;
     size_t pixel_map_size;
     struct zmk_color_hsl *colors;
     uint8_t num_colors;
-    uint16_t duration;
-    uint16_t transition_duration;
+    uint32_t duration;
+    uint32_t transition_duration;
+    uint8_t fps;
 };
 
 struct fx_solid_data {
-    uint16_t counter;
+    /**
+     * Time elapsed since the start of the cycle in milliseconds.
+     */
+    uint32_t counter;
+    bool dirty;
 
     struct zmk_color_hsl current_hsl;
     struct zmk_color_rgb current_rgb;
@@ -36,43 +41,72 @@ static void fx_solid_update_color(const struct device *dev) {
     const struct fx_solid_config *config = dev->config;
     struct fx_solid_data *data = dev->data;
 
-    const size_t from = data->counter / config->transition_duration;
+    // The cycle might not divide evenly, the remainder is spent on the last transition
+    const size_t from = MIN(data->counter / config->transition_duration, config->num_colors - 1);
     const size_t to = (from + 1) % config->num_colors;
 
     struct zmk_color_hsl next_hsl;
 
     zmk_interpolate_hsl(&config->colors[from], &config->colors[to], &next_hsl,
-                        (data->counter % config->transition_duration) /
-                            (float)config->transition_duration);
+                        zmk_color_fraction(data->counter % config->transition_duration,
+                                           config->transition_duration));
 
     data->current_hsl = next_hsl;
     zmk_hsl_to_rgb(&data->current_hsl, &data->current_rgb);
-
-    data->counter = (data->counter + 1) % config->duration;
 }
 
-static void fx_solid_render_frame(const struct device *dev, struct rgb_fx_pixel *pixels,
-                                  size_t num_pixels) {
+/**
+ * Moves the color cycle forward by the elapsed time.
+ */
+static void fx_solid_advance(const struct device *dev, uint32_t delta_ms) {
     const struct fx_solid_config *config = dev->config;
     struct fx_solid_data *data = dev->data;
 
-    for (size_t i = 0; i < config->pixel_map_size; ++i) {
-        pixels[config->pixel_map[i]].value = data->current_rgb;
-    }
+    data->dirty = false;
 
     if (config->num_colors == 1) {
         return;
     }
 
-    // Request frames on counter reset
-    if (data->counter == 0) {
-        zmk_rgb_fx_request_frames(config->duration);
-    }
+    data->counter = (data->counter + delta_ms) % config->duration;
 
     fx_solid_update_color(dev);
+
+    zmk_rgb_fx_request_frames_at(1, config->fps);
+}
+
+static ALWAYS_INLINE void fx_solid_draw(const struct device *dev, const struct rgb_fx_frame *frame,
+                                         const zmk_rgb_fx_pixel_idx_t *pixel_map) {
+    const struct fx_solid_config *config = dev->config;
+    const struct fx_solid_data *data = dev->data;
+
+    for (size_t i = 0; i < config->pixel_map_size; ++i) {
+        frame->colors[rgb_fx_pixel_index(pixel_map, i)] = data->current_rgb;
+    }
+}
+
+static void fx_solid_render_frame(const struct device *dev, const struct rgb_fx_frame *frame,
+                                  uint32_t delta_ms) {
+    const struct fx_solid_config *config = dev->config;
+
+    if (config->pixel_map == NULL) {
+        fx_solid_draw(dev, frame, NULL);
+    } else {
+        fx_solid_draw(dev, frame, config->pixel_map);
+    }
+
+    fx_solid_advance(dev, delta_ms);
+}
+
+static void fx_solid_skip_frame(const struct device *dev, uint32_t delta_ms) {
+    fx_solid_advance(dev, delta_ms);
 }
 
 static void fx_solid_start(const struct device *dev) {
+    struct fx_solid_data *data = dev->data;
+
+    data->dirty = true;
+
     zmk_rgb_fx_request_frames(1);
 }
 
@@ -92,32 +126,45 @@ static int fx_solid_init(const struct device *dev) {
     return 0;
 }
 
+static bool fx_solid_is_dirty(const struct device *dev) {
+    const struct fx_solid_config *config = dev->config;
+    const struct fx_solid_data *data = dev->data;
+
+    return data->dirty || config->num_colors > 1;
+}
+
 static const struct rgb_fx_api fx_solid_api = {
     .on_start = fx_solid_start,
     .on_stop = fx_solid_stop,
     .render_frame = fx_solid_render_frame,
+    .is_dirty = fx_solid_is_dirty,
+    .skip_frame = fx_solid_skip_frame,
 };
 
 #define FX_SOLID_DEVICE(idx)                                                                       \
                                                                                                    \
     static struct fx_solid_data fx_solid_##idx##_data;                                             \
                                                                                                    \
-    static size_t fx_ripple_##idx##_pixel_map[] = DT_INST_PROP(idx, pixels);                       \
+    static const zmk_rgb_fx_pixel_idx_t fx_ripple_##idx##_pixel_map[] =                            \
+        DT_INST_PROP(idx, pixels);                                                                 \
                                                                                                    \
     static uint32_t fx_solid_##idx##_colors[] = DT_INST_PROP(idx, colors);                         \
                                                                                                    \
     static struct fx_solid_config fx_solid_##idx##_config = {                                      \
-        .pixel_map = &fx_ripple_##idx##_pixel_map[0],                                              \
+        .pixel_map = RGB_FX_DT_INST_PIXEL_MAP(idx, fx_ripple_##idx##_pixel_map),                   \
         .pixel_map_size = DT_INST_PROP_LEN(idx, pixels),                                           \
         .colors = (struct zmk_color_hsl *)fx_solid_##idx##_colors,                                 \
         .num_colors = DT_INST_PROP_LEN(idx, colors),                                               \
-        .duration = DT_INST_PROP(idx, duration) * CONFIG_ZMK_RGB_FX_FPS,                           \
-        .transition_duration = (DT_INST_PROP(idx, duration) * CONFIG_ZMK_RGB_FX_FPS) /             \
-                               DT_INST_PROP_LEN(idx, colors),                                      \
+        .duration = DT_INST_PROP(idx, duration) * 1000,                                            \
+        .transition_duration =                                                                     \
+            (DT_INST_PROP(idx, duration) * 1000) / DT_INST_PROP_LEN(idx, colors),                  \
+        .fps = DT_INST_PROP_OR(idx, fps, 0),                                                       \
     };                                                                                             \
                                                                                                    \
     DEVICE_DT_INST_DEFINE(idx, &fx_solid_init, NULL, &fx_solid_##idx##_data,                       \
                           &fx_solid_##idx##_config, POST_KERNEL,                                   \
-                          CONFIG_APPLICATION_INIT_PRIORITY, &fx_solid_api);
+                          CONFIG_APPLICATION_INIT_PRIORITY, &fx_solid_api);                        \
+                                                                                                   \
+    RGB_FX_DT_INST_DEFINE_RENDER(idx, fx_solid_render_frame)
 
 DT_INST_FOREACH_STATUS_OKAY(FX_SOLID_DEVICE);
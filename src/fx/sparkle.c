@@ -6,8 +6,6 @@
 
 #define DT_DRV_COMPAT zmk_rgb_fx_sparkle
 
-#include <stdlib.h>
-
 #include <zephyr/device.h>
 #include <zephyr/kernel.h>
 #include <zephyr/logging/log.h>
@@ -18,77 +16,176 @@
 
 LOG_MODULE_DECLARE(zmk, CONFIG_ZMK_LOG_LEVEL);
 
+/**
+ * Seed used when the instance doesn't specify one. The instance index is added to it,
+ * so multiple sparkle effects don't light up the same pixels in sync.
+ */
+#define FX_SPARKLE_DEFAULT_SEED 0x2545F491
+
 struct fx_sparkle_pixel {
     struct zmk_color_rgb color;
-    uint16_t total_frames;
-    uint16_t counter;
-    float step;
+
+    /**
+     * Duration of the fade-in in milliseconds. The fade-out takes the same amount of time.
+     */
+    uint32_t total_time;
+
+    /**
+     * Time remaining until the end of the fade-out in milliseconds.
+     */
+    uint32_t counter;
 };
 
 struct fx_sparkle_config {
-    size_t *pixel_map;
+    const zmk_rgb_fx_pixel_idx_t *pixel_map;
     size_t pixel_map_size;
     struct zmk_color_hsl *colors;
     size_t num_colors;
     uint8_t duration;
-    uint8_t blending_mode;
+    zmk_blend_span_t blend_span;
+    uint8_t fps;
 };
 
 struct fx_sparkle_data {
     struct fx_sparkle_pixel *pixels;
+
+    /**
+     * Color of every sparkle when only a single color is given.
+     */
+    struct zmk_color_rgb color;
+
+    /**
+     * State of the random number generator, never zero.
+     */
+    uint32_t rng_state;
 };
 
-static void fx_sparkle_generate_pixel(const struct device *dev, uint8_t ipx, bool offset_counter) {
+/**
+ * Advances the xorshift32 generator of the instance. It's far cheaper than rand() and,
+ * being seeded per instance, the sparkles are the same on every run.
+ */
+static uint32_t fx_sparkle_random(struct fx_sparkle_data *data) {
+    uint32_t x = data->rng_state;
+
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+
+    data->rng_state = x;
+
+    return x;
+}
+
+/**
+ * Returns a random value in the [0, range) interval, using a multiplication instead of a modulo.
+ */
+static uint32_t fx_sparkle_random_below(struct fx_sparkle_data *data, uint32_t range) {
+    return ((uint64_t)fx_sparkle_random(data) * range) >> 32;
+}
+
+static void fx_sparkle_generate_pixel(const struct device *dev, size_t ipx, bool offset_counter) {
     const struct fx_sparkle_config *config = dev->config;
-    const struct fx_sparkle_data *data = dev->data;
+    struct fx_sparkle_data *data = dev->data;
+
+    struct fx_sparkle_pixel *pixel = &data->pixels[ipx];
 
     if (config->num_colors > 1) {
         struct zmk_color_hsl color;
 
         zmk_interpolate_hsl(&config->colors[0], &config->colors[1], &color,
-                            1.0f / (float)(rand() % 100));
-        zmk_hsl_to_rgb(&color, &data->pixels[ipx].color);
+                            ZMK_COLOR_FRACTION(1, fx_sparkle_random_below(data, 99) + 1));
+        zmk_hsl_to_rgb(&color, &pixel->color);
     } else {
-        zmk_hsl_to_rgb(&config->colors[0], &data->pixels[ipx].color);
+        pixel->color = data->color;
     }
 
-    data->pixels[ipx].total_frames =
-        (config->duration * CONFIG_ZMK_RGB_FX_FPS) / ((rand() % 16) + 1);
-    data->pixels[ipx].counter = 2 * data->pixels[ipx].total_frames;
-    data->pixels[ipx].step = 1.0f / (float)data->pixels[ipx].total_frames;
+    // At least a millisecond, so a zero duration doesn't lead to a division by zero.
+    pixel->total_time =
+        MAX((config->duration * 1000) / (fx_sparkle_random_below(data, 16) + 1), 1);
+    pixel->counter = 2 * pixel->total_time;
 
     if (offset_counter) {
-        data->pixels[ipx].counter = rand() % data->pixels[ipx].counter;
+        pixel->counter = fx_sparkle_random_below(data, pixel->counter);
     }
 }
 
-static void fx_sparkle_render_frame(const struct device *dev, struct rgb_fx_pixel *pixels,
-                                    size_t num_pixels) {
+/**
+ * Starts a new sparkle on every pixel whose previous one has faded out.
+ */
+static void fx_sparkle_regenerate(const struct device *dev) {
+    const struct fx_sparkle_config *config = dev->config;
+    const struct fx_sparkle_data *data = dev->data;
+
+    for (size_t i = 0; i < config->pixel_map_size; ++i) {
+        if (data->pixels[i].counter == 0) {
+            fx_sparkle_generate_pixel(dev, i, false);
+        }
+    }
+}
+
+static ALWAYS_INLINE void fx_sparkle_draw(const struct device *dev,
+                                           const struct rgb_fx_frame *frame, uint32_t delta_ms,
+                                           const zmk_rgb_fx_pixel_idx_t *pixel_map) {
     const struct fx_sparkle_config *config = dev->config;
     struct fx_sparkle_data *data = dev->data;
 
-    for (int i = 0; i < config->pixel_map_size; ++i) {
-        --data->pixels[i].counter;
+    struct zmk_color_rgb span[ZMK_BLEND_SPAN_SIZE];
+    bool expired = false;
 
-        float intensity = data->pixels[i].total_frames <= data->pixels[i].counter
-                              ? 2.0f - (data->pixels[i].step * (float)(data->pixels[i].counter))
-                              : data->pixels[i].step * (float)(data->pixels[i].counter);
+    for (size_t start = 0; start < config->pixel_map_size; start += ZMK_BLEND_SPAN_SIZE) {
+        const size_t count = MIN(config->pixel_map_size - start, ZMK_BLEND_SPAN_SIZE);
 
-        struct zmk_color_rgb color = {
-            .r = intensity * data->pixels[i].color.r,
-            .g = intensity * data->pixels[i].color.g,
-            .b = intensity * data->pixels[i].color.b,
-        };
+        for (size_t i = 0; i < count; ++i) {
+            struct fx_sparkle_pixel *pixel = &data->pixels[start + i];
 
-        pixels[config->pixel_map[i]].value = zmk_apply_blending_mode(
-            pixels[config->pixel_map[i]].value, color, config->blending_mode);
+            pixel->counter = pixel->counter > delta_ms ? pixel->counter - delta_ms : 0;
 
-        if (data->pixels[i].counter == 0) {
-            fx_sparkle_generate_pixel(dev, i, false);
+            // Fade in during the first half of the cycle, fade out during the second one.
+            zmk_color_fraction_t intensity =
+                pixel->total_time <= pixel->counter
+                    ? zmk_color_fraction(2 * pixel->total_time - pixel->counter, pixel->total_time)
+                    : zmk_color_fraction(pixel->counter, pixel->total_time);
+
+            zmk_scale_rgb(&pixel->color, &span[i], intensity);
+
+            expired |= pixel->counter == 0;
         }
+
+        rgb_fx_blend_span(config->blend_span, frame, pixel_map, start, span, count);
     }
 
-    zmk_rgb_fx_request_frames(1);
+    // New sparkles are generated in a separate pass, keeping the render loop free of them.
+    if (expired) {
+        fx_sparkle_regenerate(dev);
+    }
+}
+
+static void fx_sparkle_render_frame(const struct device *dev, const struct rgb_fx_frame *frame,
+                                    uint32_t delta_ms) {
+    const struct fx_sparkle_config *config = dev->config;
+
+    if (config->pixel_map == NULL) {
+        fx_sparkle_draw(dev, frame, delta_ms, NULL);
+    } else {
+        fx_sparkle_draw(dev, frame, delta_ms, config->pixel_map);
+    }
+
+    zmk_rgb_fx_request_frames_at(1, config->fps);
+}
+
+static void fx_sparkle_skip_frame(const struct device *dev, uint32_t delta_ms) {
+    const struct fx_sparkle_config *config = dev->config;
+    struct fx_sparkle_data *data = dev->data;
+
+    for (size_t i = 0; i < config->pixel_map_size; ++i) {
+        struct fx_sparkle_pixel *pixel = &data->pixels[i];
+
+        pixel->counter = pixel->counter > delta_ms ? pixel->counter - delta_ms : 0;
+    }
+
+    fx_sparkle_regenerate(dev);
+
+    zmk_rgb_fx_request_frames_at(1, config->fps);
 }
 
 static void fx_sparkle_start(const struct device *dev) {
@@ -101,8 +198,11 @@ static void fx_sparkle_stop(const struct device *dev) {
 
 static int fx_sparkle_init(const struct device *dev) {
     const struct fx_sparkle_config *config = dev->config;
+    struct fx_sparkle_data *data = dev->data;
 
-    for (uint8_t i = 0; i < config->pixel_map_size; ++i) {
+    zmk_hsl_to_rgb(&config->colors[0], &data->color);
+
+    for (size_t i = 0; i < config->pixel_map_size; ++i) {
         fx_sparkle_generate_pixel(dev, i, true);
     }
 
@@ -113,32 +213,40 @@ static const struct rgb_fx_api fx_sparkle_api = {
     .on_start = fx_sparkle_start,
     .on_stop = fx_sparkle_stop,
     .render_frame = fx_sparkle_render_frame,
+    .skip_frame = fx_sparkle_skip_frame,
 };
 
 #define FX_SPARKLE_DEVICE(idx)                                                                     \
                                                                                                    \
-    static size_t fx_sparkle_##idx##_pixel_map[] = DT_INST_PROP(idx, pixels);                      \
+    static const zmk_rgb_fx_pixel_idx_t fx_sparkle_##idx##_pixel_map[] =                           \
+        DT_INST_PROP(idx, pixels);                                                                 \
                                                                                                    \
     static uint32_t fx_sparkle_##idx##_colors[] = DT_INST_PROP(idx, colors);                       \
                                                                                                    \
     static struct fx_sparkle_config fx_sparkle_##idx##_config = {                                  \
-        .pixel_map = &fx_sparkle_##idx##_pixel_map[0],                                             \
+        .pixel_map = RGB_FX_DT_INST_PIXEL_MAP(idx, fx_sparkle_##idx##_pixel_map),                  \
         .pixel_map_size = DT_INST_PROP_LEN(idx, pixels),                                           \
         .colors = (struct zmk_color_hsl *)&fx_sparkle_##idx##_colors,                              \
         .num_colors = DT_INST_PROP_LEN(idx, colors),                                               \
         .duration = DT_INST_PROP(idx, duration),                                                   \
-        .blending_mode = DT_INST_ENUM_IDX(idx, blending_mode),                                     \
+        .blend_span = ZMK_BLEND_SPAN(DT_INST_STRING_TOKEN(idx, blending_mode)),                    \
+        .fps = DT_INST_PROP_OR(idx, fps, 0),                                                       \
     };                                                                                             \
                                                                                                    \
     static struct fx_sparkle_pixel                                                                 \
         fx_sparkle_##idx##_pixels[DT_INST_PROP_LEN(idx, pixels)];                                  \
                                                                                                    \
+    BUILD_ASSERT(DT_INST_PROP_OR(idx, seed, 1) != 0, "The sparkle seed must not be zero");         \
+                                                                                                   \
     static struct fx_sparkle_data fx_sparkle_##idx##_data = {                                      \
         .pixels = &fx_sparkle_##idx##_pixels[0],                                                   \
+        .rng_state = (uint32_t)DT_INST_PROP_OR(idx, seed, FX_SPARKLE_DEFAULT_SEED + idx),          \
     };                                                                                             \
                                                                                                    \
     DEVICE_DT_INST_DEFINE(idx, &fx_sparkle_init, NULL, &fx_sparkle_##idx##_data,                   \
                           &fx_sparkle_##idx##_config, POST_KERNEL,                                 \
-                          CONFIG_APPLICATION_INIT_PRIORITY, &fx_sparkle_api);
+                          CONFIG_APPLICATION_INIT_PRIORITY, &fx_sparkle_api);                      \
+                                                                                                   \
+    RGB_FX_DT_INST_DEFINE_RENDER(idx, fx_sparkle_render_frame)
 
 DT_INST_FOREACH_STATUS_OKAY(FX_SPARKLE_DEVICE);
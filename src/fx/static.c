@@ -20,25 +20,51 @@
 LOG_MODULE_DECLARE(zmk, CONFIG_ZMK_LOG_LEVEL);
 
 struct fx_static_config {
-	size_t *pixel_map;
+	const zmk_rgb_fx_pixel_idx_t *pixel_map;
 	size_t pixel_map_size;
 	struct zmk_color_hsl *colors_hsl;
 	struct zmk_color_rgb *colors_rgb;
-    uint8_t blending_mode;
+	zmk_blend_span_t blend_span;
 };
 
-static void fx_static_render_frame(const struct device *dev, struct rgb_fx_pixel *pixels,
-								   size_t num_pixels) {
+struct fx_static_data {
+	bool dirty;
+};
+
+static ALWAYS_INLINE void fx_static_draw(const struct device *dev, const struct rgb_fx_frame *frame,
+										  const zmk_rgb_fx_pixel_idx_t *pixel_map) {
 	const struct fx_static_config *config = dev->config;
 
-	for (size_t i = 0; i < config->pixel_map_size; ++i) {
-        pixels[config->pixel_map[i]].value =
-            zmk_apply_blending_mode(pixels[config->pixel_map[i]].value, config->colors_rgb[i],
-            					    config->blending_mode);
+	// The colors are computed at init, so they can be blended as a single span.
+	rgb_fx_blend_span(config->blend_span, frame, pixel_map, 0, config->colors_rgb,
+					  config->pixel_map_size);
+}
+
+static void fx_static_render_frame(const struct device *dev, const struct rgb_fx_frame *frame,
+								   uint32_t delta_ms) {
+	const struct fx_static_config *config = dev->config;
+	struct fx_static_data *data = dev->data;
+
+	if (config->pixel_map == NULL) {
+		fx_static_draw(dev, frame, NULL);
+	} else {
+		fx_static_draw(dev, frame, config->pixel_map);
 	}
+
+	data->dirty = false;
+}
+
+static void fx_static_skip_frame(const struct device *dev, uint32_t delta_ms) {
+	struct fx_static_data *data = dev->data;
+
+	data->dirty = false;
 }
 
 static void fx_static_start(const struct device *dev) {
+	struct fx_static_data *data = dev->data;
+
+	data->dirty = true;
+
 	zmk_rgb_fx_request_frames(1);
 }
 
@@ -56,29 +82,43 @@ static int fx_static_init(const struct device *dev) {
 	return 0;
 }
 
+static bool fx_static_is_dirty(const struct device *dev) {
+	const struct fx_static_data *data = dev->data;
+
+	return data->dirty;
+}
+
 static const struct rgb_fx_api fx_static_api = {
 	.on_start = fx_static_start,
 	.on_stop = fx_static_stop,
 	.render_frame = fx_static_render_frame,
+	.is_dirty = fx_static_is_dirty,
+	.skip_frame = fx_static_skip_frame,
 };
 
 #define FX_STATIC_DEVICE(idx)                                                                      \
                                                                                                    \
-	static size_t fx_static_##idx##_pixel_map[] = DT_INST_PROP(idx, pixels);                       \
+	static struct fx_static_data fx_static_##idx##_data;                                           \
+                                                                                                   \
+	static const zmk_rgb_fx_pixel_idx_t fx_static_##idx##_pixel_map[] =                            \
+		DT_INST_PROP(idx, pixels);                                                                 \
                                                                                                    \
 	static uint32_t fx_static_##idx##_colors_hsl[] = DT_INST_PROP(idx, colors);                    \
                                                                                                    \
 	static struct zmk_color_rgb fx_static_##idx##_colors_rgb[DT_INST_PROP_LEN(idx, colors)];       \
                                                                                                    \
 	static struct fx_static_config fx_static_##idx##_config = {                                    \
-		.pixel_map = fx_static_##idx##_pixel_map,                                                  \
+		.pixel_map = RGB_FX_DT_INST_PIXEL_MAP(idx, fx_static_##idx##_pixel_map),                   \
 		.pixel_map_size = DT_INST_PROP_LEN(idx, pixels),                                           \
 		.colors_hsl = (struct zmk_color_hsl *)fx_static_##idx##_colors_hsl,                        \
 		.colors_rgb = fx_static_##idx##_colors_rgb,                                                \
-	    .blending_mode = DT_INST_ENUM_IDX(idx, blending_mode),                                     \
+		.blend_span = ZMK_BLEND_SPAN(DT_INST_STRING_TOKEN(idx, blending_mode)),                    \
 	};                                                                                             \
                                                                                                    \
-	DEVICE_DT_INST_DEFINE(idx, &fx_static_init, NULL, NULL, &fx_static_##idx##_config, POST_KERNEL,\
-		                  CONFIG_APPLICATION_INIT_PRIORITY, &fx_static_api);
+	DEVICE_DT_INST_DEFINE(idx, &fx_static_init, NULL, &fx_static_##idx##_data,                     \
+		                  &fx_static_##idx##_config, POST_KERNEL,                                  \
+		                  CONFIG_APPLICATION_INIT_PRIORITY, &fx_static_api);                       \
+                                                                                                   \
+	RGB_FX_DT_INST_DEFINE_RENDER(idx, fx_static_render_frame)
 
 DT_INST_FOREACH_STATUS_OKAY(FX_STATIC_DEVICE);
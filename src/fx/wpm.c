@@ -17,6 +17,7 @@
 #include <zephyr/device.h>
 #include <zephyr/kernel.h>
 #include <zephyr/logging/log.h>
+#include <zephyr/sys/atomic.h>
 
 #include <drivers/rgb_fx.h>
 #include <zmk/event_manager.h>
@@ -25,7 +26,7 @@
 LOG_MODULE_DECLARE(zmk, CONFIG_ZMK_LOG_LEVEL);
 
 struct fx_wpm_config {
-    size_t *pixel_map;
+    const zmk_rgb_fx_pixel_idx_t *pixel_map;
     size_t pixel_map_size;
     struct zmk_color_hsl *colors;
     bool is_multi_color;
@@ -33,8 +34,13 @@ struct fx_wpm_config {
     uint8_t bounds_max;
     bool is_horizontal;
     uint8_t max_wpm;
-    uint8_t blending_mode;
+    zmk_blend_span_t blend_span;
     uint8_t edge_width;
+    uint8_t fps;
+};
+
+struct fx_wpm_data {
+    bool dirty;
 };
 
 /**
@@ -48,6 +54,12 @@ static uint8_t keystrokes[] = {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0};
  */
 static uint8_t keystrokes_index = 0;
 
+/**
+ * Keystrokes counted by the event listener, which are moved into the buffer
+ * by the calculation running on the work queue.
+ */
+static atomic_t keystrokes_pending = ATOMIC_INIT(0);
+
 /**
  * The second-latest WPM measurement value.
  */
@@ -68,7 +80,7 @@ static void fx_wpm_calc_value(struct k_work *work);
 K_WORK_DEFINE(fx_wpm_work, fx_wpm_calc_value);
 
 static void fx_wpm_tick_handler(struct k_timer *timer) {
-    k_work_submit(&fx_wpm_work);
+    k_work_submit_to_queue(zmk_rgb_fx_work_q(), &fx_wpm_work);
 }
 
 K_TIMER_DEFINE(fx_wpm_tick, fx_wpm_tick_handler, NULL);
@@ -82,6 +94,11 @@ static void fx_wpm_calc_value(struct k_work *work) {
     float averages = 0.0;
     float weights = 0.0;
 
+    // MIN() evaluates its arguments twice, so the pending keystrokes are taken out first.
+    const atomic_val_t pending = atomic_clear(&keystrokes_pending);
+
+    keystrokes[keystrokes_index] = MIN(keystrokes[keystrokes_index] + pending, UINT8_MAX);
+
     for (size_t i = 0; i < WPM_CALC_BUFFER_LENGTH; ++i) {
         float distance = keystrokes_index - i + (i > keystrokes_index ? WPM_CALC_BUFFER_LENGTH : 0);
         float weight = exp(-((distance * distance) / (2 * WPM_CALC_SIGMA)));
@@ -126,7 +143,7 @@ static int fx_wpm_on_key_press(const zmk_event_t *event) {
         return 0;
     }
 
-    keystrokes[keystrokes_index] += 1;
+    atomic_inc(&keystrokes_pending);
 
     if (k_timer_remaining_get(&fx_wpm_tick) == 0) {
         k_timer_start(&fx_wpm_tick, K_MSEC(WPM_CALC_INTERVAL), K_MSEC(WPM_CALC_INTERVAL));
@@ -138,7 +155,8 @@ static int fx_wpm_on_key_press(const zmk_event_t *event) {
 ZMK_LISTENER(fx_wpm, fx_wpm_on_key_press);
 ZMK_SUBSCRIPTION(fx_wpm, zmk_position_state_changed);
 
-static struct zmk_color_rgb fx_wpm_get_frame_color(const struct device *dev, float step) {
+static struct zmk_color_rgb fx_wpm_get_frame_color(const struct device *dev,
+                                                   zmk_color_fraction_t step) {
     const struct fx_wpm_config *config = dev->config;
 
     struct zmk_color_rgb rgb;
@@ -155,67 +173,104 @@ static struct zmk_color_rgb fx_wpm_get_frame_color(const struct device *dev, flo
     return rgb;
 }
 
-static void fx_wpm_render_frame(const struct device *dev, struct rgb_fx_pixel *pixels,
-                                size_t num_pixels) {
+/**
+ * The WPM value is interpolated from the uptime, so only the frame requests need to be kept up.
+ */
+static void fx_wpm_advance(const struct device *dev) {
     const struct fx_wpm_config *config = dev->config;
+    struct fx_wpm_data *data = dev->data;
 
-    const size_t *pixel_map = config->pixel_map;
+    // Once both measurements settle at zero, the output stays the same until the next keystroke.
+    data->dirty = last_wpm != 0 || current_wpm != 0;
 
-    float timestamp_delta =
-        ((float)(k_uptime_get() - current_wpm_timestamp)) / ((float)WPM_CALC_INTERVAL);
-
-    if (timestamp_delta > 1) {
-        timestamp_delta = 1.0f;
+    if (!data->dirty) {
+        return;
     }
 
-    const float wpm_delta = (float)last_wpm + (((float)current_wpm - (float)last_wpm) * timestamp_delta);
-    const float step = wpm_delta < config->max_wpm ? wpm_delta / ((float)config->max_wpm) : 1.0f;
+    zmk_rgb_fx_request_frames_at(1, config->fps);
+}
 
-    const struct zmk_color_rgb color = fx_wpm_get_frame_color(dev, step);
+static ALWAYS_INLINE void fx_wpm_draw(const struct device *dev, const struct rgb_fx_frame *frame,
+                                       struct zmk_color_rgb color, int gradient_edge,
+                                       int direction, const zmk_rgb_fx_pixel_idx_t *pixel_map) {
+    const struct fx_wpm_config *config = dev->config;
 
-    const int direction = config->bounds_max > config->bounds_min ? 1 : -1;
-    const int gradient_edge =
-        config->bounds_min + (abs(config->bounds_max - config->bounds_min) + config->edge_width) *
-        step * direction;
+    struct zmk_color_rgb span[ZMK_BLEND_SPAN_SIZE];
 
-    for (size_t i = 0; i < config->pixel_map_size; ++i) {
-        const int position = config->is_horizontal ? pixels[pixel_map[i]].position_x
-                                                       : pixels[pixel_map[i]].position_y;
-        struct zmk_color_rgb gradient_color;
+    for (size_t start = 0; start < config->pixel_map_size; start += ZMK_BLEND_SPAN_SIZE) {
+        const size_t count = MIN(config->pixel_map_size - start, ZMK_BLEND_SPAN_SIZE);
 
-        if (direction * (position - gradient_edge) >= 0) {
-            gradient_color = (struct zmk_color_rgb){0.0f, 0.0f, 0.0f};
+        for (size_t i = 0; i < count; ++i) {
+            const size_t px = rgb_fx_pixel_index(pixel_map, start + i);
+            const int position =
+                config->is_horizontal ? frame->positions[px].x : frame->positions[px].y;
 
-            pixels[pixel_map[i]].value =
-                zmk_apply_blending_mode(pixels[pixel_map[i]].value, gradient_color, config->blending_mode);
+            if (direction * (position - gradient_edge) >= 0) {
+                span[i] = (struct zmk_color_rgb){0, 0, 0};
+                continue;
+            }
 
-            continue;
-        }
+            if (direction * (gradient_edge - position) >= config->edge_width) {
+                span[i] = color;
+                continue;
+            }
 
-        if (direction * (gradient_edge - position) >= config->edge_width) {
-            pixels[pixel_map[i]].value =
-                zmk_apply_blending_mode(pixels[pixel_map[i]].value, color, config->blending_mode);
+            zmk_color_fraction_t gradient_step =
+                ZMK_COLOR_FRACTION(abs(position - gradient_edge), config->edge_width);
 
-            continue;
+            zmk_scale_rgb(&color, &span[i], gradient_step);
         }
 
-        float gradient_step = abs(position - gradient_edge) / (float)config->edge_width;
-        gradient_color.r = color.r * gradient_step;
-        gradient_color.g = color.g * gradient_step;
-        gradient_color.b = color.b * gradient_step;
+        rgb_fx_blend_span(config->blend_span, frame, pixel_map, start, span, count);
+    }
+}
+
+static void fx_wpm_render_frame(const struct device *dev, const struct rgb_fx_frame *frame,
+                                uint32_t delta_ms) {
+    const struct fx_wpm_config *config = dev->config;
 
-        pixels[pixel_map[i]].value =
-            zmk_apply_blending_mode(pixels[pixel_map[i]].value, gradient_color, config->blending_mode);
+    int64_t timestamp_delta = k_uptime_get() - current_wpm_timestamp;
+
+    if (timestamp_delta > WPM_CALC_INTERVAL) {
+        timestamp_delta = WPM_CALC_INTERVAL;
     }
 
-    if (last_wpm == 0 && current_wpm == 0) {
-        return;
+    // Interpolated WPM value with 8 fractional bits, which takes the maximum past the range of
+    // ZMK_COLOR_FRACTION().
+    const int32_t wpm_max = config->max_wpm << 8;
+    const int32_t wpm_delta =
+        MIN(((last_wpm * WPM_CALC_INTERVAL + (current_wpm - last_wpm) * (int32_t)timestamp_delta)
+             << 8) / WPM_CALC_INTERVAL,
+            wpm_max);
+
+    const zmk_color_fraction_t step = zmk_color_fraction(wpm_delta, wpm_max);
+
+    const struct zmk_color_rgb color = fx_wpm_get_frame_color(dev, step);
+
+    const int direction = config->bounds_max > config->bounds_min ? 1 : -1;
+    const int gradient_edge =
+        config->bounds_min +
+        (abs(config->bounds_max - config->bounds_min) + config->edge_width) * wpm_delta / wpm_max *
+            direction;
+
+    if (config->pixel_map == NULL) {
+        fx_wpm_draw(dev, frame, color, gradient_edge, direction, NULL);
+    } else {
+        fx_wpm_draw(dev, frame, color, gradient_edge, direction, config->pixel_map);
     }
 
-    zmk_rgb_fx_request_frames(1);
+    fx_wpm_advance(dev);
 }
 
-static void fx_wpm_start(const struct device *dev) { zmk_rgb_fx_request_frames(1); }
+static void fx_wpm_skip_frame(const struct device *dev, uint32_t delta_ms) { fx_wpm_advance(dev); }
+
+static void fx_wpm_start(const struct device *dev) {
+    struct fx_wpm_data *data = dev->data;
+
+    data->dirty = true;
+
+    zmk_rgb_fx_request_frames(1);
+}
 
 static void fx_wpm_stop(const struct device *dev) {
     // Nothing to do.
@@ -226,20 +281,34 @@ static int fx_wpm_init(const struct device *dev) {
     return 0;
 };
 
+static bool fx_wpm_is_dirty(const struct device *dev) {
+    const struct fx_wpm_data *data = dev->data;
+
+    return data->dirty || last_wpm != 0 || current_wpm != 0;
+}
+
 static const struct rgb_fx_api fx_wpm_api = {
     .on_start = fx_wpm_start,
     .on_stop = fx_wpm_stop,
     .render_frame = fx_wpm_render_frame,
+    .is_dirty = fx_wpm_is_dirty,
+    .skip_frame = fx_wpm_skip_frame,
 };
 
 #define FX_WPM_DEVICE(idx)                                                                         \
                                                                                                    \
-    static size_t fx_wpm_##idx##_pixel_map[] = DT_INST_PROP(idx, pixels);                          \
+    BUILD_ASSERT(DT_INST_PROP(idx, max_wpm) > 0 && DT_INST_PROP(idx, max_wpm) <= UINT8_MAX,        \
+                 "The maximum WPM must be between 1 and 255");                                     \
+                                                                                                   \
+    static struct fx_wpm_data fx_wpm_##idx##_data;                                                 \
+                                                                                                   \
+    static const zmk_rgb_fx_pixel_idx_t fx_wpm_##idx##_pixel_map[] =                               \
+        DT_INST_PROP(idx, pixels);                                                                 \
                                                                                                    \
     static uint32_t fx_wpm_##idx##_colors[] = DT_INST_PROP(idx, colors);                           \
                                                                                                    \
     static struct fx_wpm_config fx_wpm_##idx##_config = {                                          \
-        .pixel_map = &fx_wpm_##idx##_pixel_map[0],                                                 \
+        .pixel_map = RGB_FX_DT_INST_PIXEL_MAP(idx, fx_wpm_##idx##_pixel_map),                      \
         .pixel_map_size = DT_INST_PROP_LEN(idx, pixels),                                           \
         .colors = (struct zmk_color_hsl *)fx_wpm_##idx##_colors,                                   \
         .is_multi_color = DT_INST_PROP_LEN(idx, colors) > 1,                                       \
@@ -247,11 +316,14 @@ static const struct rgb_fx_api fx_wpm_api = {
         .bounds_max = DT_INST_PROP_BY_IDX(idx, bounds, 1),                                         \
         .is_horizontal = 0 == (DT_INST_ENUM_IDX(idx, bounds_axis)),                                \
         .max_wpm = DT_INST_PROP(idx, max_wpm),                                                     \
-        .blending_mode = DT_INST_ENUM_IDX(idx, blending_mode),                                     \
+        .blend_span = ZMK_BLEND_SPAN(DT_INST_STRING_TOKEN(idx, blending_mode)),                    \
         .edge_width = DT_INST_PROP(idx, edge_gradient_width),                                      \
+        .fps = DT_INST_PROP_OR(idx, fps, 0),                                                       \
     };                                                                                             \
                                                                                                    \
-    DEVICE_DT_INST_DEFINE(idx, &fx_wpm_init, NULL, NULL, &fx_wpm_##idx##_config,                   \
-                          POST_KERNEL, CONFIG_APPLICATION_INIT_PRIORITY, &fx_wpm_api);
+    DEVICE_DT_INST_DEFINE(idx, &fx_wpm_init, NULL, &fx_wpm_##idx##_data, &fx_wpm_##idx##_config,   \
+                          POST_KERNEL, CONFIG_APPLICATION_INIT_PRIORITY, &fx_wpm_api);             \
+                                                                                                   \
+    RGB_FX_DT_INST_DEFINE_RENDER(idx, fx_wpm_render_frame)
 
 DT_INST_FOREACH_STATUS_OKAY(FX_WPM_DEVICE);
@@ -7,6 +7,7 @@
 #define DT_DRV_COMPAT zmk_rgb_fx
 
 #include <stdlib.h>
+#include <string.h>
 #include <math.h>
 
 #include <zephyr/device.h>
@@ -14,6 +15,7 @@
 #include <zephyr/init.h>
 #include <zephyr/kernel.h>
 #include <zephyr/logging/log.h>
+#include <zephyr/sys/atomic.h>
 
 #include <drivers/rgb_fx.h>
 
@@ -21,14 +23,27 @@
 #include <zmk/event_manager.h>
 #include <zmk/events/activity_state_changed.h>
 
+#if IS_ENABLED(CONFIG_ZMK_RGB_FX_FPS_GOVERNOR)
+#include <zmk/usb.h>
+#include <zmk/events/usb_conn_state_changed.h>
+#endif
+
+#if IS_ENABLED(CONFIG_ZMK_RGB_FX_STATS)
+#include <zmk/rgb_fx_stats.h>
+#endif
+
+#if IS_ENABLED(CONFIG_ZMK_RGB_FX_FRAME_DUMP)
+#include <zmk/rgb_fx_frame_dump.h>
+#endif
+
 LOG_MODULE_DECLARE(zmk, CONFIG_ZMK_LOG_LEVEL);
 
 #define PHANDLE_TO_DEVICE(node_id, prop, idx) DEVICE_DT_GET(DT_PHANDLE_BY_IDX(node_id, prop, idx)),
 
-#define PHANDLE_TO_PIXEL(node_id, prop, idx)                                                       \
+#define PHANDLE_TO_POSITION(node_id, prop, idx)                                                    \
     {                                                                                              \
-        .position_x = DT_PHA_BY_IDX(node_id, prop, idx, position_x),                               \
-        .position_y = DT_PHA_BY_IDX(node_id, prop, idx, position_y),                               \
+        .x = DT_PHA_BY_IDX(node_id, prop, idx, position_x),                                        \
+        .y = DT_PHA_BY_IDX(node_id, prop, idx, position_y),                                        \
     },
 
 /**
@@ -51,32 +66,152 @@ static const size_t pixels_per_driver[] = DT_INST_PROP(0, chain_lengths);
  */
 static const struct device *fx_root = DEVICE_DT_GET(DT_CHOSEN(zmk_rgb_fx));
 
+#if IS_ENABLED(CONFIG_ZMK_RGB_FX_STATIC_GRAPH)
+RGB_FX_DT_DECLARE_RENDER(DT_CHOSEN(zmk_rgb_fx))
+#endif
+
+const struct rgb_fx_pixel_position rgb_fx_pixel_positions[] = {
+    DT_INST_FOREACH_PROP_ELEM(0, pixels, PHANDLE_TO_POSITION)};
+
+/**
+ * Frame the animation renders into.
+ */
+RGB_FX_FRAME_DEFINE(frame_buffer, colors);
+
+/**
+ * RGB values ready to be sent to the drivers.
+ */
+struct zmk_rgb_fx_output_frame {
+    struct led_rgb pixels[DT_INST_PROP_LEN(0, pixels)];
+
+    /**
+     * Whether the pixels handled by each driver need to be sent.
+     */
+    bool changed[DT_INST_PROP_LEN(0, drivers)];
+};
+
+#if IS_ENABLED(CONFIG_ZMK_RGB_FX_ASYNC_OUTPUT)
+/**
+ * One frame is being converted while the other one is being transmitted by the output thread.
+ */
+static struct zmk_rgb_fx_output_frame output_frames[2];
+
+/**
+ * Index of the frame the next render is converted into.
+ */
+static size_t output_back = 0;
+
+/**
+ * Frame handed over to the output thread.
+ */
+static struct zmk_rgb_fx_output_frame *output_front;
+
+K_SEM_DEFINE(output_ready, 0, 1);
+K_SEM_DEFINE(output_idle, 1, 1);
+#else
+static struct zmk_rgb_fx_output_frame output_frames[1];
+#endif
+
+/**
+ * Duration of the stages of the last frame, in hardware cycles.
+ * The transmission is timed on the output thread when it's enabled, and all of them are read
+ * from the shell, so they're kept in atomics.
+ */
+static atomic_t render_cycles = ATOMIC_INIT(0);
+static atomic_t stall_cycles = ATOMIC_INIT(0);
+static atomic_t transmit_cycles = ATOMIC_INIT(0);
+
+void zmk_rgb_fx_get_frame_timing(struct zmk_rgb_fx_frame_timing *timing) {
+    timing->render_ns = k_cyc_to_ns_floor32((uint32_t)atomic_get(&render_cycles));
+    timing->stall_ns = k_cyc_to_ns_floor32((uint32_t)atomic_get(&stall_cycles));
+    timing->transmit_ns = k_cyc_to_ns_floor32((uint32_t)atomic_get(&transmit_cycles));
+}
+
+#if IS_ENABLED(CONFIG_ZMK_RGB_FX_SKIP_UNCHANGED)
+/**
+ * Copy of the last frame sent to the drivers.
+ * led_strip drivers are allowed to overwrite the buffer they're given,
+ * so the output frame itself can't be used for the comparison.
+ */
+static struct led_rgb px_shadow[DT_INST_PROP_LEN(0, pixels)];
+
+/**
+ * Cleared whenever the LEDs may no longer show the contents of px_shadow.
+ */
+static bool px_shadow_valid = false;
+
 /**
- * Pixel configuration.
+ * Number of driver updates skipped because the pixels didn't change.
+ * Counted on the work queue and read from the shell.
  */
-static struct rgb_fx_pixel pixels[] = {DT_INST_FOREACH_PROP_ELEM(0, pixels, PHANDLE_TO_PIXEL)};
+static atomic_t skipped_transfers = ATOMIC_INIT(0);
+
+uint32_t zmk_rgb_fx_get_skipped_transfers(void) {
+    return (uint32_t)atomic_get(&skipped_transfers);
+}
+#endif
+
+#if IS_ENABLED(CONFIG_ZMK_RGB_FX_WORK_QUEUE)
+K_THREAD_STACK_DEFINE(rgb_fx_work_q_stack, CONFIG_ZMK_RGB_FX_WORK_QUEUE_STACK_SIZE);
 
 /**
- * Size of the pixels array.
+ * Work queue for rendering and other effect related work,
+ * so it doesn't hold up the system work queue.
  */
-static const size_t pixels_size = DT_INST_PROP_LEN(0, pixels);
+static struct k_work_q rgb_fx_work_q;
+
+struct k_work_q *zmk_rgb_fx_work_q(void) { return &rgb_fx_work_q; }
+#else
+struct k_work_q *zmk_rgb_fx_work_q(void) { return &k_sys_work_q; }
+#endif
 
 /**
- * Buffer for RGB values ready to be sent to the drivers.
+ * Value of fx_timer_countdown while the animation timer is stopped.
  */
-static struct led_rgb px_buffer[DT_INST_PROP_LEN(0, pixels)];
+#define FX_TIMER_IDLE -1
 
 /**
  * Counter for effect animation frames that have been requested but have yet to be executed.
+ * It's decremented from the timer ISR and raised from any thread requesting frames.
+ * The timer keeps running while the effects keep requesting frames and only goes
+ * idle once a whole frame period passes without a request.
+ */
+static atomic_t fx_timer_countdown = ATOMIC_INIT(FX_TIMER_IDLE);
+
+/**
+ * Maximum frame rate, which can be changed at runtime.
+ */
+static atomic_t fx_max_fps = ATOMIC_INIT(CONFIG_ZMK_RGB_FX_FPS);
+
+/**
+ * Frame rate the animation timer is running at.
  */
-static uint32_t fx_timer_countdown = 0;
+static atomic_t fx_timer_fps = ATOMIC_INIT(CONFIG_ZMK_RGB_FX_FPS);
+
+/**
+ * Highest frame rate requested by the effects since the start of the last frame,
+ * UINT8_MAX if an effect didn't specify one.
+ */
+static atomic_t fx_requested_fps = ATOMIC_INIT(0);
+
+#if IS_ENABLED(CONFIG_ZMK_RGB_FX_FPS_GOVERNOR)
+/**
+ * Set while the keyboard is in the idle activity state.
+ */
+static bool fx_idle = false;
+#endif
+
+/**
+ * Uptime of the previous frame, used to compute the time elapsed between frames.
+ */
+static uint32_t fx_last_frame_time = 0;
 
 /**
  * Conditional implementation of zmk_rgb_fx_get_pixel_by_key_position
  * if key-pixels is set.
  */
 #if DT_INST_NODE_HAS_PROP(0, key_position)
-static const uint8_t pixels_by_key_position[] = DT_INST_PROP(0, key_pixels);
+static const zmk_rgb_fx_pixel_idx_t pixels_by_key_position[] = DT_INST_PROP(0, key_pixels);
 
 size_t zmk_rgb_fx_get_pixel_by_key_position(size_t key_position) {
     return pixels_by_key_position[key_position];
@@ -85,107 +220,430 @@ size_t zmk_rgb_fx_get_pixel_by_key_position(size_t key_position) {
 
 #if defined(CONFIG_ZMK_RGB_FX_PIXEL_DISTANCE) && (CONFIG_ZMK_RGB_FX_PIXEL_DISTANCE == 1)
 
+#define PIXEL_X(idx) DT_INST_PHA_BY_IDX(0, pixels, idx, position_x)
+#define PIXEL_Y(idx) DT_INST_PHA_BY_IDX(0, pixels, idx, position_y)
+
+/**
+ * Distances are normalized to fit inside the 0-255 range of uint8_t.
+ * The longest possible distance in the 255x255 coordinate space is roughly 360.
+ */
+#define PIXEL_DISTANCE(j, i)                                                                       \
+    (uint8_t)(__builtin_sqrt((PIXEL_X(i) - PIXEL_X(j)) * (PIXEL_X(i) - PIXEL_X(j)) +               \
+                             (PIXEL_Y(i) - PIXEL_Y(j)) * (PIXEL_Y(i) - PIXEL_Y(j))) *              \
+              255 / 360)
+
+#define PIXEL_DISTANCE_ROW(node_id, prop, i) LISTIFY(UTIL_INC(i), PIXEL_DISTANCE, (, ), i),
+
 /**
  * Lookup table for distance between any two pixels.
  *
  * The values are stored as a triangular matrix which cuts the space requirement roughly in half.
+ * The table is generated by the compiler from the pixel positions in the devicetree,
+ * so it's stored in flash and doesn't have to be computed during boot.
  */
-static uint8_t
-    pixel_distance[((DT_INST_PROP_LEN(0, pixels) + 1) * DT_INST_PROP_LEN(0, pixels)) / 2];
+static const uint8_t pixel_distance[] = {
+    DT_INST_FOREACH_PROP_ELEM(0, pixels, PIXEL_DISTANCE_ROW)};
+
+BUILD_ASSERT(ARRAY_SIZE(pixel_distance) ==
+                 ((DT_INST_PROP_LEN(0, pixels) + 1) * DT_INST_PROP_LEN(0, pixels)) / 2,
+             "Unexpected size of the pixel distance lookup table");
 
 uint8_t zmk_rgb_fx_get_pixel_distance(size_t pixel_idx, size_t other_pixel_idx) {
     if (pixel_idx < other_pixel_idx) {
         return zmk_rgb_fx_get_pixel_distance(other_pixel_idx, pixel_idx);
     }
 
+    ZMK_RGB_FX_COUNT_OPS(1);
+
     return pixel_distance[(((pixel_idx + 1) * pixel_idx) >> 1) + other_pixel_idx];
 }
 
 #endif
 
+/**
+ * Converts a range of pixels into the led_rgb format and resets them for the next frame.
+ *
+ * @return True if the converted pixels differ from the ones last sent to the driver.
+ */
+static bool zmk_rgb_fx_convert_pixels(struct led_rgb *px_buffer, size_t offset, size_t length) {
+#if IS_ENABLED(CONFIG_ZMK_RGB_FX_SKIP_UNCHANGED)
+    bool changed = !px_shadow_valid;
+#else
+    bool changed = true;
+#endif
+
+    zmk_rgb_to_led_rgb_span(&colors[offset], &px_buffer[offset], length);
+
+    // Reset values for the next cycle
+    memset(&colors[offset], 0, length * sizeof(colors[0]));
+
+#if IS_ENABLED(CONFIG_ZMK_RGB_FX_SKIP_UNCHANGED)
+    for (size_t i = offset; i < offset + length; ++i) {
+        if (px_buffer[i].r != px_shadow[i].r || px_buffer[i].g != px_shadow[i].g ||
+            px_buffer[i].b != px_shadow[i].b) {
+            px_shadow[i].r = px_buffer[i].r;
+            px_shadow[i].g = px_buffer[i].g;
+            px_shadow[i].b = px_buffer[i].b;
+
+            changed = true;
+        }
+    }
+#endif
+
+    return changed;
+}
+
+/**
+ * Sends the changed parts of a frame to the LED drivers.
+ */
+static void zmk_rgb_fx_transmit(struct zmk_rgb_fx_output_frame *frame) {
+    const uint32_t start = k_cycle_get_32();
+
+    size_t offset = 0;
+
+    for (size_t i = 0; i < drivers_size; ++i) {
+        if (frame->changed[i]) {
+            led_strip_update_rgb(drivers[i], &frame->pixels[offset], pixels_per_driver[i]);
+        }
+
+        offset += pixels_per_driver[i];
+    }
+
+    const uint32_t transmitted = k_cycle_get_32() - start;
+
+    atomic_set(&transmit_cycles, transmitted);
+
+#if IS_ENABLED(CONFIG_ZMK_RGB_FX_STATS)
+    zmk_rgb_fx_stats_record_phase(ZMK_RGB_FX_STATS_PHASE_TRANSMIT, transmitted);
+#endif
+}
+
+#if IS_ENABLED(CONFIG_ZMK_RGB_FX_ASYNC_OUTPUT)
+static void zmk_rgb_fx_output_thread(void *p1, void *p2, void *p3) {
+    while (true) {
+        k_sem_take(&output_ready, K_FOREVER);
+
+        zmk_rgb_fx_transmit(output_front);
+
+        k_sem_give(&output_idle);
+    }
+}
+
+K_THREAD_DEFINE(zmk_rgb_fx_output_thread_id, CONFIG_ZMK_RGB_FX_ASYNC_OUTPUT_STACK_SIZE,
+                zmk_rgb_fx_output_thread, NULL, NULL, NULL,
+                CONFIG_ZMK_RGB_FX_ASYNC_OUTPUT_PRIORITY, 0, 0);
+#endif
+
+static void zmk_rgb_fx_update_fps(void);
+
 static void zmk_rgb_fx_tick(struct k_work *work) {
-    rgb_fx_render_frame(fx_root, &pixels[0], pixels_size);
+    const uint32_t now = k_uptime_get_32();
+    const uint32_t delta_ms = now - fx_last_frame_time;
 
-    for (size_t i = 0; i < pixels_size; ++i) {
-        zmk_rgb_to_led_rgb(&pixels[i].value, &px_buffer[i]);
+    fx_last_frame_time = now;
 
-        // Reset values for the next cycle
-        pixels[i].value.r = 0;
-        pixels[i].value.g = 0;
-        pixels[i].value.b = 0;
+    // The effects request the frame rate they need for the next frame while rendering.
+    atomic_clear(&fx_requested_fps);
+
+    if (!rgb_fx_is_dirty(fx_root)) {
+        // The frame would be identical to the one already displayed, but the frame rate still
+        // drops back now that nothing asked for a faster one.
+        zmk_rgb_fx_update_fps();
+        return;
     }
 
+#if IS_ENABLED(CONFIG_ZMK_RGB_FX_FRAME_DUMP)
+    zmk_rgb_fx_frame_dump_begin_frame();
+#endif
+
+    const uint32_t start = k_cycle_get_32();
+
+#if IS_ENABLED(CONFIG_ZMK_RGB_FX_STATIC_GRAPH)
+    RGB_FX_DT_RENDER_FN(DT_CHOSEN(zmk_rgb_fx))(&frame_buffer, delta_ms);
+#else
+    rgb_fx_render_frame(fx_root, &frame_buffer, delta_ms);
+#endif
+
+#if IS_ENABLED(CONFIG_ZMK_RGB_FX_STATS)
+    const uint32_t converting = k_cycle_get_32();
+#endif
+
+#if IS_ENABLED(CONFIG_ZMK_RGB_FX_ASYNC_OUTPUT)
+    // The back frame isn't used by the output thread, so it can be filled right away.
+    struct zmk_rgb_fx_output_frame *frame = &output_frames[output_back];
+#else
+    struct zmk_rgb_fx_output_frame *frame = &output_frames[0];
+#endif
+
     size_t pixels_updated = 0;
 
     for (size_t i = 0; i < drivers_size; ++i) {
-        led_strip_update_rgb(drivers[i], &px_buffer[pixels_updated], pixels_per_driver[i]);
+        frame->changed[i] =
+            zmk_rgb_fx_convert_pixels(frame->pixels, pixels_updated, pixels_per_driver[i]);
+
+#if IS_ENABLED(CONFIG_ZMK_RGB_FX_SKIP_UNCHANGED)
+        if (!frame->changed[i]) {
+            atomic_inc(&skipped_transfers);
+        }
+#endif
 
         pixels_updated += pixels_per_driver[i];
     }
+
+#if IS_ENABLED(CONFIG_ZMK_RGB_FX_SKIP_UNCHANGED)
+    px_shadow_valid = true;
+#endif
+
+    const uint32_t rendered = k_cycle_get_32();
+
+    atomic_set(&render_cycles, rendered - start);
+
+#if IS_ENABLED(CONFIG_ZMK_RGB_FX_FRAME_DUMP)
+    zmk_rgb_fx_frame_dump_end_frame(frame->pixels, ARRAY_SIZE(frame->pixels));
+#endif
+
+#if IS_ENABLED(CONFIG_ZMK_RGB_FX_STATS)
+    zmk_rgb_fx_stats_record_phase(ZMK_RGB_FX_STATS_PHASE_CONVERT, rendered - converting);
+#endif
+
+#if IS_ENABLED(CONFIG_ZMK_RGB_FX_ASYNC_OUTPUT)
+    // Wait for the previous frame to be sent out before handing over the new one.
+    k_sem_take(&output_idle, K_FOREVER);
+
+    const uint32_t stalled = k_cycle_get_32() - rendered;
+
+    atomic_set(&stall_cycles, stalled);
+
+    output_front = frame;
+    output_back = 1 - output_back;
+
+    k_sem_give(&output_ready);
+
+#if IS_ENABLED(CONFIG_ZMK_RGB_FX_STATS)
+    zmk_rgb_fx_stats_record_phase(ZMK_RGB_FX_STATS_PHASE_STALL, stalled);
+#endif
+#else
+    atomic_set(&stall_cycles, 0);
+
+    zmk_rgb_fx_transmit(frame);
+#endif
+
+#if IS_ENABLED(CONFIG_ZMK_RGB_FX_STATS)
+    zmk_rgb_fx_stats_record_phase(ZMK_RGB_FX_STATS_PHASE_FRAME, k_cycle_get_32() - start);
+#endif
+
+    zmk_rgb_fx_update_fps();
 }
 
 K_WORK_DEFINE(animation_work, zmk_rgb_fx_tick);
 
 static void zmk_rgb_fx_tick_handler(struct k_timer *timer) {
-    if (--fx_timer_countdown == 0) {
-        k_timer_stop(timer);
+    atomic_val_t remaining;
+
+    do {
+        remaining = atomic_get(&fx_timer_countdown);
+
+        if (remaining <= 0) {
+            break;
+        }
+    } while (!atomic_cas(&fx_timer_countdown, remaining, remaining - 1));
+
+    if (remaining <= 0) {
+        // Nothing was requested since the last frame, so the animation went idle.
+        if (atomic_cas(&fx_timer_countdown, 0, FX_TIMER_IDLE)) {
+            k_timer_stop(timer);
+        }
+
+        return;
     }
 
-    k_work_submit(&animation_work);
+#if IS_ENABLED(CONFIG_ZMK_RGB_FX_STATS)
+    if (k_work_submit_to_queue(zmk_rgb_fx_work_q(), &animation_work) == 0) {
+        // The previous frame is still queued, so this one is merged into it.
+        zmk_rgb_fx_stats_record_missed_frame();
+    }
+#else
+    k_work_submit_to_queue(zmk_rgb_fx_work_q(), &animation_work);
+#endif
 }
 
 K_TIMER_DEFINE(animation_tick, zmk_rgb_fx_tick_handler, NULL);
 
-void zmk_rgb_fx_request_frames(uint32_t frames) {
-    if (frames <= fx_timer_countdown) {
-        return;
+/**
+ * Picks the frame rate for the given request, capped by the maximum frame rate
+ * and the power state of the keyboard.
+ */
+static uint8_t zmk_rgb_fx_target_fps(atomic_val_t requested) {
+    uint8_t fps = atomic_get(&fx_max_fps);
+
+#if IS_ENABLED(CONFIG_ZMK_RGB_FX_FPS_GOVERNOR)
+    if (fx_idle) {
+        fps = MIN(fps, CONFIG_ZMK_RGB_FX_FPS_IDLE);
+    }
+
+    if (!zmk_usb_is_powered()) {
+        fps = MIN(fps, CONFIG_ZMK_RGB_FX_FPS_BATTERY);
     }
+#endif
 
-    if (fx_timer_countdown == 0) {
-        k_timer_start(&animation_tick, K_MSEC(1000 / CONFIG_ZMK_RGB_FX_FPS),
-                      K_MSEC(1000 / CONFIG_ZMK_RGB_FX_FPS));
+    if (requested > 0) {
+        fps = MIN(fps, requested);
     }
 
-    fx_timer_countdown = frames;
+    return fps;
 }
 
-static int zmk_rgb_fx_on_activity_state_changed(const zmk_event_t *event) {
-    const struct zmk_activity_state_changed *activity_state_event;
+static void zmk_rgb_fx_start_timer(uint8_t fps) {
+    atomic_set(&fx_timer_fps, fps);
 
-    if ((activity_state_event = as_zmk_activity_state_changed(event)) == NULL) {
-        // Event not supported.
-        return -ENOTSUP;
+    k_timer_start(&animation_tick, K_MSEC(1000 / fps), K_MSEC(1000 / fps));
+}
+
+/**
+ * Applies a change of the target frame rate to a running animation.
+ */
+static void zmk_rgb_fx_update_fps(void) {
+    const uint8_t fps = zmk_rgb_fx_target_fps(atomic_get(&fx_requested_fps));
+
+    if (fps != atomic_get(&fx_timer_fps) && atomic_get(&fx_timer_countdown) != FX_TIMER_IDLE) {
+        zmk_rgb_fx_start_timer(fps);
     }
+}
+
+void zmk_rgb_fx_request_frames_at(uint32_t frames, uint8_t fps) {
+    const atomic_val_t wanted_fps = fps > 0 ? fps : UINT8_MAX;
+    atomic_val_t requested_fps;
+
+    do {
+        requested_fps = atomic_get(&fx_requested_fps);
+
+        if (wanted_fps <= requested_fps) {
+            break;
+        }
+    } while (!atomic_cas(&fx_requested_fps, requested_fps, wanted_fps));
+
+    atomic_val_t remaining;
+
+    do {
+        remaining = atomic_get(&fx_timer_countdown);
+
+        if (frames == 0 || (remaining != FX_TIMER_IDLE && frames <= (uint32_t)remaining)) {
+            break;
+        }
+    } while (!atomic_cas(&fx_timer_countdown, remaining, frames));
+
+    const uint8_t target_fps = zmk_rgb_fx_target_fps(atomic_get(&fx_requested_fps));
+
+    if (remaining == FX_TIMER_IDLE) {
+        // Only the request which woke the animation up starts the timer.
+        if (frames > 0) {
+            // Time spent idle doesn't count towards the first frame, which is one period away.
+            fx_last_frame_time = k_uptime_get_32();
+
+            zmk_rgb_fx_start_timer(target_fps);
+        }
 
-    switch (activity_state_event->state) {
+        return;
+    }
+
+    // Speed up straight away if a faster effect became active.
+    if (target_fps > atomic_get(&fx_timer_fps)) {
+        zmk_rgb_fx_start_timer(target_fps);
+    }
+}
+
+void zmk_rgb_fx_request_frames(uint32_t frames) { zmk_rgb_fx_request_frames_at(frames, 0); }
+
+int zmk_rgb_fx_set_fps(uint8_t fps) {
+    if (fps == 0 || fps > 60) {
+        return -EINVAL;
+    }
+
+    atomic_set(&fx_max_fps, fps);
+
+    // Apply the new period to a running animation straight away.
+    zmk_rgb_fx_update_fps();
+
+    return 0;
+}
+
+uint8_t zmk_rgb_fx_get_fps(void) { return atomic_get(&fx_timer_fps); }
+
+/**
+ * Latest activity state of the keyboard, applied to the effects from the work queue.
+ */
+static atomic_t fx_activity_state = ATOMIC_INIT(ZMK_ACTIVITY_ACTIVE);
+
+static void zmk_rgb_fx_apply_activity_state(struct k_work *work) {
+    switch (atomic_get(&fx_activity_state)) {
     case ZMK_ACTIVITY_ACTIVE:
+#if IS_ENABLED(CONFIG_ZMK_RGB_FX_FPS_GOVERNOR)
+        fx_idle = false;
+#endif
+#if IS_ENABLED(CONFIG_ZMK_RGB_FX_SKIP_UNCHANGED)
+        // The LEDs might have lost power during sleep, so the next frame is always sent.
+        px_shadow_valid = false;
+#endif
         rgb_fx_start(fx_root);
-        return 0;
+        return;
+#if IS_ENABLED(CONFIG_ZMK_RGB_FX_FPS_GOVERNOR)
+    case ZMK_ACTIVITY_IDLE:
+        fx_idle = true;
+        zmk_rgb_fx_update_fps();
+        return;
+#endif
     case ZMK_ACTIVITY_SLEEP:
         rgb_fx_stop(fx_root);
         k_timer_stop(&animation_tick);
-        fx_timer_countdown = 0;
-        return 0;
+        atomic_set(&fx_timer_countdown, FX_TIMER_IDLE);
+        return;
     default:
+        return;
+    }
+}
+
+K_WORK_DEFINE(activity_work, zmk_rgb_fx_apply_activity_state);
+
+static int zmk_rgb_fx_on_activity_state_changed(const zmk_event_t *event) {
+    const struct zmk_activity_state_changed *activity_state_event;
+
+#if IS_ENABLED(CONFIG_ZMK_RGB_FX_FPS_GOVERNOR) && IS_ENABLED(CONFIG_ZMK_USB)
+    if (as_zmk_usb_conn_state_changed(event) != NULL) {
+        zmk_rgb_fx_update_fps();
         return 0;
     }
+#endif
+
+    if ((activity_state_event = as_zmk_activity_state_changed(event)) == NULL) {
+        // Event not supported.
+        return -ENOTSUP;
+    }
+
+    // The effects are started and stopped on the work queue, so it can't happen mid-frame.
+    atomic_set(&fx_activity_state, activity_state_event->state);
+    k_work_submit_to_queue(zmk_rgb_fx_work_q(), &activity_work);
+
+    return 0;
 }
 
-static int zmk_rgb_fx_init() {
-// #if defined(CONFIG_ZMK_ANIMATION_PIXEL_DISTANCE) && (CONFIG_ZMK_ANIMATION_PIXEL_DISTANCE == 1)
-//     // Prefill the pixel distance lookup table
-//     int k = 0;
-//     for (size_t i = 0; i < pixels_size; ++i) {
-//         for (size_t j = 0; j <= i; ++j) {
-//             // Distances are normalized to fit inside 0-255 range to fit inside uint8_t
-//             // for better space efficiency
-//             pixel_distance[k++] = sqrt(pow(pixels[i].position_x - pixels[j].position_x, 2) +
-//                                        pow(pixels[i].position_y - pixels[j].position_y, 2)) *
-//                                   255 / 360;
-//         }
-//     }
-// #endif
+#if IS_ENABLED(CONFIG_ZMK_RGB_FX_WORK_QUEUE)
+/**
+ * The work queue is started ahead of the devices and the event listeners which submit to it.
+ */
+static int zmk_rgb_fx_work_q_init() {
+    const struct k_work_queue_config work_q_config = {.name = "rgb_fx_work_q"};
 
+    k_work_queue_start(&rgb_fx_work_q, rgb_fx_work_q_stack,
+                       K_THREAD_STACK_SIZEOF(rgb_fx_work_q_stack),
+                       CONFIG_ZMK_RGB_FX_WORK_QUEUE_PRIORITY, &work_q_config);
+
+    return 0;
+}
+
+SYS_INIT(zmk_rgb_fx_work_q_init, POST_KERNEL, 0);
+#endif
+
+static int zmk_rgb_fx_init() {
     LOG_INF("ZMK RGB FX Ready");
 
     rgb_fx_start(fx_root);
@@ -197,3 +655,7 @@ SYS_INIT(zmk_rgb_fx_init, APPLICATION, CONFIG_APPLICATION_INIT_PRIORITY);
 
 ZMK_LISTENER(amk_rgb_fx, zmk_rgb_fx_on_activity_state_changed);
 ZMK_SUBSCRIPTION(amk_rgb_fx, zmk_activity_state_changed);
+
+#if IS_ENABLED(CONFIG_ZMK_RGB_FX_FPS_GOVERNOR) && IS_ENABLED(CONFIG_ZMK_USB)
+ZMK_SUBSCRIPTION(amk_rgb_fx, zmk_usb_conn_state_changed);
+#endif
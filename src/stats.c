@@ -0,0 +1,218 @@
+/*
+ * Copyright (c) 2024 Kuba Birecki
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <stdio.h>
+#include <string.h>
+
+#include <zephyr/device.h>
+#include <zephyr/init.h>
+#include <zephyr/kernel.h>
+#include <zephyr/logging/log.h>
+#include <zephyr/spinlock.h>
+
+#if IS_ENABLED(CONFIG_ZMK_RGB_FX_STATS_SHELL)
+#include <zephyr/shell/shell.h>
+#endif
+
+#include <zmk/rgb_fx.h>
+#include <zmk/rgb_fx_stats.h>
+
+LOG_MODULE_DECLARE(zmk, CONFIG_ZMK_LOG_LEVEL);
+
+#define STATS_FX_DEVICE(node_id) DEVICE_DT_GET(node_id),
+
+struct rgb_fx_stat {
+    uint32_t count;
+    uint32_t min;
+    uint32_t max;
+    uint64_t total;
+};
+
+/**
+ * Every effect device enabled in the devicetree.
+ */
+static const struct device *fx_devices[] = {
+    DT_FOREACH_STATUS_OKAY(zmk_rgb_fx_compose, STATS_FX_DEVICE)
+    DT_FOREACH_STATUS_OKAY(zmk_rgb_fx_control_group, STATS_FX_DEVICE)
+    DT_FOREACH_STATUS_OKAY(zmk_rgb_fx_linear_gradient, STATS_FX_DEVICE)
+    DT_FOREACH_STATUS_OKAY(zmk_rgb_fx_ripple, STATS_FX_DEVICE)
+    DT_FOREACH_STATUS_OKAY(zmk_rgb_fx_solid, STATS_FX_DEVICE)
+    DT_FOREACH_STATUS_OKAY(zmk_rgb_fx_sparkle, STATS_FX_DEVICE)
+    DT_FOREACH_STATUS_OKAY(zmk_rgb_fx_static, STATS_FX_DEVICE)
+    DT_FOREACH_STATUS_OKAY(zmk_rgb_fx_wpm, STATS_FX_DEVICE)
+};
+
+static const char *phase_names[] = {
+    [ZMK_RGB_FX_STATS_PHASE_FRAME] = "frame",
+    [ZMK_RGB_FX_STATS_PHASE_CONVERT] = "convert",
+    [ZMK_RGB_FX_STATS_PHASE_STALL] = "stall",
+    [ZMK_RGB_FX_STATS_PHASE_TRANSMIT] = "transmit",
+};
+
+static struct rgb_fx_stat fx_stats[ARRAY_SIZE(fx_devices)];
+
+static struct rgb_fx_stat phase_stats[ZMK_RGB_FX_STATS_PHASE_COUNT];
+
+/**
+ * Frames which took longer than the frame period.
+ */
+static uint32_t late_frames = 0;
+
+/**
+ * Frames which were dropped because the previous one was still queued.
+ */
+static uint32_t missed_frames = 0;
+
+/**
+ * Effects are rendered from the animation work queue, the transmit phase may be recorded
+ * by the output thread and the statistics are read and reset from the shell.
+ */
+static struct k_spinlock lock;
+
+static void rgb_fx_stat_add(struct rgb_fx_stat *stat, uint32_t cycles) {
+    if (stat->count == 0 || cycles < stat->min) {
+        stat->min = cycles;
+    }
+
+    if (cycles > stat->max) {
+        stat->max = cycles;
+    }
+
+    stat->count++;
+    stat->total += cycles;
+}
+
+void zmk_rgb_fx_stats_record_fx(const struct device *dev, uint32_t cycles) {
+    for (size_t i = 0; i < ARRAY_SIZE(fx_devices); ++i) {
+        if (fx_devices[i] == dev) {
+            K_SPINLOCK(&lock) { rgb_fx_stat_add(&fx_stats[i], cycles); }
+            return;
+        }
+    }
+}
+
+void zmk_rgb_fx_stats_record_phase(enum zmk_rgb_fx_stats_phase phase, uint32_t cycles) {
+    K_SPINLOCK(&lock) {
+        rgb_fx_stat_add(&phase_stats[phase], cycles);
+
+        if (phase == ZMK_RGB_FX_STATS_PHASE_FRAME &&
+            cycles > k_ms_to_cyc_ceil32(1000 / zmk_rgb_fx_get_fps())) {
+            late_frames++;
+        }
+    }
+}
+
+void zmk_rgb_fx_stats_record_missed_frame(void) {
+    K_SPINLOCK(&lock) { missed_frames++; }
+}
+
+void zmk_rgb_fx_stats_reset(void) {
+    K_SPINLOCK(&lock) {
+        memset(fx_stats, 0, sizeof(fx_stats));
+        memset(phase_stats, 0, sizeof(phase_stats));
+        late_frames = 0;
+        missed_frames = 0;
+    }
+}
+
+/**
+ * Formats a single row of the statistics table, with all durations in microseconds.
+ */
+static void rgb_fx_stats_format(char *buf, size_t len, const char *name,
+                                const struct rgb_fx_stat *stat) {
+    const uint32_t avg = stat->count > 0 ? stat->total / stat->count : 0;
+
+    snprintf(buf, len, "%-32s %8u %8u %8u %8u", name, stat->count,
+             (uint32_t)k_cyc_to_us_floor64(stat->min), (uint32_t)k_cyc_to_us_floor64(avg),
+             (uint32_t)k_cyc_to_us_floor64(stat->max));
+}
+
+/**
+ * Takes a consistent copy of the statistics and passes every formatted row to the callback.
+ */
+static void rgb_fx_stats_foreach_row(void (*print)(void *ctx, const char *row), void *ctx) {
+    struct rgb_fx_stat fx_copy[ARRAY_SIZE(fx_devices)];
+    struct rgb_fx_stat phase_copy[ZMK_RGB_FX_STATS_PHASE_COUNT];
+    uint32_t late, missed;
+    char row[80];
+
+    K_SPINLOCK(&lock) {
+        memcpy(fx_copy, fx_stats, sizeof(fx_stats));
+        memcpy(phase_copy, phase_stats, sizeof(phase_stats));
+        late = late_frames;
+        missed = missed_frames;
+    }
+
+    snprintf(row, sizeof(row), "%-32s %8s %8s %8s %8s", "us", "count", "min", "avg", "max");
+    print(ctx, row);
+
+    for (size_t i = 0; i < ARRAY_SIZE(fx_devices); ++i) {
+        rgb_fx_stats_format(row, sizeof(row), fx_devices[i]->name, &fx_copy[i]);
+        print(ctx, row);
+    }
+
+    for (size_t i = 0; i < ZMK_RGB_FX_STATS_PHASE_COUNT; ++i) {
+        rgb_fx_stats_format(row, sizeof(row), phase_names[i], &phase_copy[i]);
+        print(ctx, row);
+    }
+
+    snprintf(row, sizeof(row), "late frames: %u, missed frames: %u, frame period: %u us", late,
+             missed, 1000000 / zmk_rgb_fx_get_fps());
+    print(ctx, row);
+}
+
+#if CONFIG_ZMK_RGB_FX_STATS_LOG_INTERVAL > 0
+static void rgb_fx_stats_log_row(void *ctx, const char *row) { LOG_INF("%s", row); }
+
+static void rgb_fx_stats_log_work(struct k_work *work);
+
+K_WORK_DELAYABLE_DEFINE(stats_log_work, rgb_fx_stats_log_work);
+
+static void rgb_fx_stats_log_work(struct k_work *work) {
+    rgb_fx_stats_foreach_row(rgb_fx_stats_log_row, NULL);
+
+    k_work_schedule(&stats_log_work, K_SECONDS(CONFIG_ZMK_RGB_FX_STATS_LOG_INTERVAL));
+}
+
+static int zmk_rgb_fx_stats_init(void) {
+    k_work_schedule(&stats_log_work, K_SECONDS(CONFIG_ZMK_RGB_FX_STATS_LOG_INTERVAL));
+
+    return 0;
+}
+
+SYS_INIT(zmk_rgb_fx_stats_init, APPLICATION, CONFIG_APPLICATION_INIT_PRIORITY);
+#endif
+
+#if IS_ENABLED(CONFIG_ZMK_RGB_FX_STATS_SHELL)
+static void rgb_fx_stats_shell_row(void *ctx, const char *row) {
+    shell_print((const struct shell *)ctx, "%s", row);
+}
+
+static int cmd_rgbfx_stats(const struct shell *sh, size_t argc, char **argv) {
+    rgb_fx_stats_foreach_row(rgb_fx_stats_shell_row, (void *)sh);
+
+    return 0;
+}
+
+static int cmd_rgbfx_stats_reset(const struct shell *sh, size_t argc, char **argv) {
+    zmk_rgb_fx_stats_reset();
+
+    shell_print(sh, "RGB effect statistics reset");
+
+    return 0;
+}
+
+SHELL_STATIC_SUBCMD_SET_CREATE(sub_rgbfx_stats,
+                               SHELL_CMD(reset, NULL, "Reset the statistics", cmd_rgbfx_stats_reset),
+                               SHELL_SUBCMD_SET_END);
+
+SHELL_STATIC_SUBCMD_SET_CREATE(sub_rgbfx,
+                               SHELL_CMD(stats, &sub_rgbfx_stats, "Print render timing statistics",
+                                         cmd_rgbfx_stats),
+                               SHELL_SUBCMD_SET_END);
+
+SHELL_CMD_REGISTER(rgbfx, &sub_rgbfx, "RGB effects", NULL);
+#endif
@@ -0,0 +1,21 @@
+/*
+ * Copyright (c) 2024 Kuba Birecki
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+/**
+ * Host clock of the benchmark on native_sim.
+ * This file is compiled against the host's C library.
+ */
+
+#include <stdint.h>
+#include <time.h>
+
+uint64_t rgb_fx_benchmark_host_ns(void) {
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return (uint64_t)ts.tv_sec * 1000000000 + (uint64_t)ts.tv_nsec;
+}
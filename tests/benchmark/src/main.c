@@ -0,0 +1,246 @@
+/*
+ * Copyright (c) 2024 Kuba Birecki
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include <zephyr/device.h>
+#include <zephyr/drivers/led_strip.h>
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+
+#include <drivers/rgb_fx.h>
+
+#include <zmk/led_strip_emul.h>
+#include <zmk/rgb_fx.h>
+#include <zmk/event_manager.h>
+#include <zmk/events/position_state_changed.h>
+
+#define STRIP_NODE DT_NODELABEL(rgb_fx_strip)
+
+#define FRAME_PERIOD_MS (1000 / CONFIG_ZMK_RGB_FX_FPS)
+#define FRAME_BUDGET_NS (1000000000 / CONFIG_ZMK_RGB_FX_FPS)
+
+/**
+ * Every stage is measured over the same number of frames. The effects are rendered for five
+ * seconds of simulated time, while keys are tapped at 75 WPM, half a frame before a frame.
+ * The taps step across the board, so the ripples start all over it.
+ */
+#define NUM_FRAMES 250
+#define TAP_INTERVAL_MS 160
+#define TAP_OFFSET_MS (FRAME_PERIOD_MS / 2)
+#define TAP_POSITION_STEP 7
+
+BUILD_ASSERT(RGB_FX_NUM_PIXELS % TAP_POSITION_STEP != 0,
+             "The taps have to reach every key of the layout");
+
+/**
+ * On native_sim the kernel cycle counter only advances with simulated time,
+ * so the stages are timed with the host's monotonic clock.
+ */
+uint64_t rgb_fx_benchmark_host_ns(void);
+
+struct benchmark_blend {
+    const char *name;
+    zmk_blend_span_t blend_span;
+};
+
+struct benchmark_sample {
+    uint32_t ns;
+    uint32_t ops;
+};
+
+static const struct device *effects[] = {
+    DEVICE_DT_GET(DT_NODELABEL(solid)),
+    DEVICE_DT_GET(DT_NODELABEL(static_colors)),
+    DEVICE_DT_GET(DT_NODELABEL(sparkle)),
+    DEVICE_DT_GET(DT_NODELABEL(ripple)),
+    DEVICE_DT_GET(DT_NODELABEL(wpm)),
+    DEVICE_DT_GET(DT_NODELABEL(gradient)),
+    DEVICE_DT_GET(DT_NODELABEL(compose)),
+    DEVICE_DT_GET(DT_NODELABEL(control_group)),
+};
+
+static const struct benchmark_blend blend_modes[] = {
+    {"blend normal", zmk_blend_span_normal},
+    {"blend multiply", zmk_blend_span_multiply},
+    {"blend lighten", zmk_blend_span_lighten},
+    {"blend darken", zmk_blend_span_darken},
+    {"blend screen", zmk_blend_span_screen},
+    {"blend subtract", zmk_blend_span_subtract},
+};
+
+static const struct device *strip = DEVICE_DT_GET(STRIP_NODE);
+
+RGB_FX_FRAME_DEFINE(frame, colors);
+
+/**
+ * Colors blended onto the frame by the blending mode stages.
+ */
+static struct zmk_color_rgb blend_colors[RGB_FX_NUM_PIXELS];
+
+static struct led_rgb pixels[RGB_FX_NUM_PIXELS];
+
+static struct benchmark_sample samples[NUM_FRAMES];
+
+static int raise_key(uint32_t position, bool pressed) {
+    return raise_zmk_position_state_changed((struct zmk_position_state_changed){
+        .source = ZMK_POSITION_STATE_CHANGE_SOURCE_LOCAL,
+        .position = position,
+        .state = pressed,
+        .timestamp = k_uptime_get(),
+    });
+}
+
+static int compare_ns(const void *a, const void *b) {
+    const uint32_t ns_a = ((const struct benchmark_sample *)a)->ns;
+    const uint32_t ns_b = ((const struct benchmark_sample *)b)->ns;
+
+    return (ns_a > ns_b) - (ns_a < ns_b);
+}
+
+static void print_header(void) {
+    TC_PRINT("%u pixels, %u frames per stage, %u FPS frame budget\n", RGB_FX_NUM_PIXELS,
+             NUM_FRAMES, CONFIG_ZMK_RGB_FX_FPS);
+    TC_PRINT("%-16s %6s %10s %8s %9s %9s %8s\n", "stage", "pixels", "ops/frame", "max ops",
+             "ns/frame", "ns/pixel", "budget");
+}
+
+static void print_row(const char *name, uint32_t ops, uint32_t max_ops, uint32_t ns) {
+    TC_PRINT("%-16s %6u %10u %8u %9u %9u %5u.%02u%%\n", name, RGB_FX_NUM_PIXELS, ops, max_ops, ns,
+             ns / RGB_FX_NUM_PIXELS, (uint32_t)((uint64_t)ns * 100 / FRAME_BUDGET_NS),
+             (uint32_t)((uint64_t)ns * 10000 / FRAME_BUDGET_NS % 100));
+}
+
+/**
+ * Prints the samples of a stage. The operation counts only depend on the effects and their
+ * input, so they're the same on every run and host. The timing is the median of the frames,
+ * which keeps the odd preempted frame on a busy host out of the table.
+ */
+static void report(const char *name) {
+    uint64_t total_ops = 0;
+    uint32_t max_ops = 0;
+
+    for (size_t i = 0; i < NUM_FRAMES; ++i) {
+        total_ops += samples[i].ops;
+        max_ops = MAX(max_ops, samples[i].ops);
+    }
+
+    qsort(samples, NUM_FRAMES, sizeof(samples[0]), compare_ns);
+
+    print_row(name, (uint32_t)(total_ops / NUM_FRAMES), max_ops, samples[NUM_FRAMES / 2].ns);
+}
+
+static void benchmark_fx(const struct device *dev) {
+    size_t next_tap = 0;
+
+    rgb_fx_start(dev);
+
+    const int64_t start = k_uptime_get();
+
+    for (size_t i = 0; i < NUM_FRAMES; ++i) {
+        const int64_t frame_time = start + (i + 1) * FRAME_PERIOD_MS;
+
+        for (; start + TAP_OFFSET_MS + next_tap * TAP_INTERVAL_MS < frame_time; ++next_tap) {
+            const uint32_t position = next_tap * TAP_POSITION_STEP % RGB_FX_NUM_PIXELS;
+
+            k_sleep(K_TIMEOUT_ABS_MS(start + TAP_OFFSET_MS + next_tap * TAP_INTERVAL_MS));
+
+            zassert_ok(raise_key(position, true), "tap %u was dropped", (unsigned int)next_tap);
+            zassert_ok(raise_key(position, false));
+        }
+
+        k_sleep(K_TIMEOUT_ABS_MS(frame_time));
+
+        memset(colors, 0, sizeof(colors));
+
+        const uint32_t start_ops = zmk_rgb_fx_get_op_count();
+        const uint64_t start_ns = rgb_fx_benchmark_host_ns();
+
+        rgb_fx_render_frame(dev, &frame, FRAME_PERIOD_MS);
+
+        samples[i].ns = (uint32_t)(rgb_fx_benchmark_host_ns() - start_ns);
+        samples[i].ops = zmk_rgb_fx_get_op_count() - start_ops;
+    }
+
+    rgb_fx_stop(dev);
+
+    report(dev->name);
+}
+
+static void benchmark_blend(const struct benchmark_blend *blend) {
+    for (size_t i = 0; i < NUM_FRAMES; ++i) {
+        // Mid-range values, so neither operand saturates the result.
+        for (size_t j = 0; j < RGB_FX_NUM_PIXELS; ++j) {
+            colors[j].r = colors[j].g = colors[j].b = ZMK_COLOR_MAX / 2;
+        }
+
+        const uint32_t start_ops = zmk_rgb_fx_get_op_count();
+        const uint64_t start_ns = rgb_fx_benchmark_host_ns();
+
+        blend->blend_span(colors, NULL, blend_colors, RGB_FX_NUM_PIXELS);
+
+        samples[i].ns = (uint32_t)(rgb_fx_benchmark_host_ns() - start_ns);
+        samples[i].ops = zmk_rgb_fx_get_op_count() - start_ops;
+    }
+
+    report(blend->name);
+}
+
+/**
+ * The tick of the animation converts the frame for the LED drivers and pushes it to them,
+ * both of which are measured here on their own.
+ */
+static void benchmark_output(void) {
+    for (size_t i = 0; i < NUM_FRAMES; ++i) {
+        const uint32_t start_ops = zmk_rgb_fx_get_op_count();
+        const uint64_t start_ns = rgb_fx_benchmark_host_ns();
+
+        zmk_rgb_to_led_rgb_span(colors, pixels, RGB_FX_NUM_PIXELS);
+
+        samples[i].ns = (uint32_t)(rgb_fx_benchmark_host_ns() - start_ns);
+        samples[i].ops = zmk_rgb_fx_get_op_count() - start_ops;
+    }
+
+    report("convert");
+
+    for (size_t i = 0; i < NUM_FRAMES; ++i) {
+        const uint32_t start_ops = zmk_rgb_fx_get_op_count();
+        const uint64_t start_ns = rgb_fx_benchmark_host_ns();
+
+        zassert_ok(led_strip_update_rgb(strip, pixels, RGB_FX_NUM_PIXELS));
+
+        samples[i].ns = (uint32_t)(rgb_fx_benchmark_host_ns() - start_ns);
+        samples[i].ops = zmk_rgb_fx_get_op_count() - start_ops;
+    }
+
+    report("push");
+
+    // Time the transfer takes on the bus modeled by the emulated strip, for comparison.
+    print_row("bus", 0, 0, zmk_led_strip_emul_bus_ns(strip, RGB_FX_NUM_PIXELS));
+}
+
+ZTEST(rgb_fx_benchmark, test_benchmark) {
+    print_header();
+
+    for (size_t i = 0; i < ARRAY_SIZE(effects); ++i) {
+        benchmark_fx(effects[i]);
+    }
+
+    for (size_t i = 0; i < RGB_FX_NUM_PIXELS; ++i) {
+        blend_colors[i].r = ZMK_COLOR_FRACTION(i % 16, 15);
+        blend_colors[i].g = ZMK_COLOR_FRACTION(15 - i % 16, 15);
+        blend_colors[i].b = ZMK_COLOR_MAX / 3;
+    }
+
+    for (size_t i = 0; i < ARRAY_SIZE(blend_modes); ++i) {
+        benchmark_blend(&blend_modes[i]);
+    }
+
+    benchmark_output();
+}
+
+ZTEST_SUITE(rgb_fx_benchmark, NULL, NULL, NULL, NULL, NULL);
@@ -0,0 +1,160 @@
+/*
+ * Copyright (c) 2024 Kuba Birecki
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <zephyr/ztest.h>
+
+#include <zmk/rgb_fx.h>
+
+/**
+ * Largest difference of a channel from the original conversion, in units of 1/65535.
+ */
+#define HSL_MAX_ERROR 1
+
+static float float_mod(float a, float b) {
+    float mod = a < 0 ? -a : a;
+    float x = b < 0 ? -b : b;
+
+    while (mod >= x) {
+        mod = mod - x;
+    }
+
+    return a < 0 ? -mod : mod;
+}
+
+static float float_abs(float a) { return a < 0 ? -a : a; }
+
+/**
+ * The floating point zmk_hsl_to_rgb() which the integer conversion replaced, kept verbatim
+ * apart from returning the channels in an array.
+ */
+static void hsl_to_rgb_reference(const struct zmk_color_hsl *hsl, float rgb[3]) {
+    float s = (float)hsl->s / 100;
+    float l = (float)hsl->l / 100;
+
+    float a = (float)hsl->h / 60;
+    float chroma = s * (1 - float_abs(2 * l - 1));
+    float x = chroma * (1 - float_abs(float_mod(a, 2) - 1));
+    float m = l - chroma / 2;
+
+    switch ((uint8_t)a % 6) {
+    case 0:
+        rgb[0] = m + chroma;
+        rgb[1] = m + x;
+        rgb[2] = m;
+        break;
+    case 1:
+        rgb[0] = m + x;
+        rgb[1] = m + chroma;
+        rgb[2] = m;
+        break;
+    case 2:
+        rgb[0] = m;
+        rgb[1] = m + chroma;
+        rgb[2] = m + x;
+        break;
+    case 3:
+        rgb[0] = m;
+        rgb[1] = m + x;
+        rgb[2] = m + chroma;
+        break;
+    case 4:
+        rgb[0] = m + x;
+        rgb[1] = m;
+        rgb[2] = m + chroma;
+        break;
+    case 5:
+        rgb[0] = m + chroma;
+        rgb[1] = m;
+        rgb[2] = m + x;
+        break;
+    }
+}
+
+/**
+ * Returns a channel in units of 1/65535, whichever the color representation.
+ */
+static double channel_to_q16(zmk_color_channel_t value) {
+#if IS_ENABLED(CONFIG_ZMK_RGB_FX_COLOR_FIXED_POINT)
+    return value;
+#else
+    return (double)value * UINT16_MAX;
+#endif
+}
+
+/**
+ * Returns the largest difference of a channel of the converted color from the reference.
+ */
+static double hsl_to_rgb_error(const struct zmk_color_hsl *hsl) {
+    struct zmk_color_rgb rgb;
+    float expected[3];
+
+    zmk_hsl_to_rgb(hsl, &rgb);
+    hsl_to_rgb_reference(hsl, expected);
+
+    const double actual[3] = {channel_to_q16(rgb.r), channel_to_q16(rgb.g), channel_to_q16(rgb.b)};
+    double max_error = 0;
+
+    for (size_t i = 0; i < ARRAY_SIZE(actual); ++i) {
+        const double error = actual[i] - (double)expected[i] * UINT16_MAX;
+
+        max_error = MAX(max_error, error < 0 ? -error : error);
+    }
+
+    return max_error;
+}
+
+ZTEST(rgb_fx_hsl, test_hsl_to_rgb_accuracy) {
+    struct zmk_color_hsl worst = {0};
+    double max_error = 0;
+
+    for (uint16_t h = 0; h < 360; ++h) {
+        for (uint8_t s = 0; s <= 100; ++s) {
+            for (uint8_t l = 0; l <= 100; ++l) {
+                const struct zmk_color_hsl hsl = {.h = h, .s = s, .l = l};
+                const double error = hsl_to_rgb_error(&hsl);
+
+                if (error > max_error) {
+                    max_error = error;
+                    worst = hsl;
+                }
+            }
+        }
+    }
+
+    TC_PRINT("largest error %u/1000 of 1/65535 at hsl(%u, %u, %u)\n",
+             (unsigned int)(max_error * 1000), worst.h, worst.s, worst.l);
+
+    zassert_true(max_error <= HSL_MAX_ERROR, "hsl(%u, %u, %u) is off by %u/1000 of 1/65535",
+                 worst.h, worst.s, worst.l, (unsigned int)(max_error * 1000));
+}
+
+ZTEST(rgb_fx_hsl, test_hsl_to_rgb_extremes) {
+    static const struct {
+        struct zmk_color_hsl hsl;
+        uint16_t r, g, b;
+    } cases[] = {
+        {{0, 0, 0}, 0, 0, 0},
+        {{0, 0, 100}, UINT16_MAX, UINT16_MAX, UINT16_MAX},
+        {{0, 100, 50}, UINT16_MAX, 0, 0},
+        {{120, 100, 50}, 0, UINT16_MAX, 0},
+        {{240, 100, 50}, 0, 0, UINT16_MAX},
+        {{359, 100, 0}, 0, 0, 0},
+        {{359, 100, 100}, UINT16_MAX, UINT16_MAX, UINT16_MAX},
+    };
+
+    // Black, white and the primaries are hit exactly, up to the rounding of the float format.
+    for (size_t i = 0; i < ARRAY_SIZE(cases); ++i) {
+        struct zmk_color_rgb rgb;
+
+        zmk_hsl_to_rgb(&cases[i].hsl, &rgb);
+
+        zassert_within(channel_to_q16(rgb.r), cases[i].r, 0.5, "case %u: red", (unsigned int)i);
+        zassert_within(channel_to_q16(rgb.g), cases[i].g, 0.5, "case %u: green", (unsigned int)i);
+        zassert_within(channel_to_q16(rgb.b), cases[i].b, 0.5, "case %u: blue", (unsigned int)i);
+    }
+}
+
+ZTEST_SUITE(rgb_fx_hsl, NULL, NULL, NULL, NULL, NULL);
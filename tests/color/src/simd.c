@@ -0,0 +1,240 @@
+/*
+ * Copyright (c) 2024 Kuba Birecki
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <zephyr/ztest.h>
+
+#include <zmk/rgb_fx.h>
+
+/**
+ * Longest span tested. Covers several whole blocks of every SIMD width plus each tail length.
+ */
+#define SPAN_MAX_LENGTH 35
+
+/**
+ * Spans start at every pixel offset up to this one, which puts the first channel at every
+ * 2-byte aligned address within a 16-byte vector.
+ */
+#define SPAN_MAX_OFFSET 8
+
+/**
+ * Guard pixels after the end of each span, which the kernels must not touch.
+ */
+#define SPAN_GUARD 8
+
+#define SPAN_BUFFER_SIZE (SPAN_MAX_OFFSET + SPAN_MAX_LENGTH + SPAN_GUARD)
+
+#define GUARD_CHANNEL 0xA5A5
+#define GUARD_BYTE 0x5A
+
+/**
+ * Operands where the fixed point math is most likely to overflow or round differently.
+ */
+static const uint16_t edge_values[] = {0, 1, 0x7FFF, 0x8000, 0xFFFE, UINT16_MAX};
+
+static const struct {
+    const char *name;
+    zmk_blend_span_t blend_span;
+    uint8_t mode;
+} blend_modes[] = {
+    {"normal", zmk_blend_span_normal, ZMK_RGB_FX_BLENDING_MODE_NORMAL},
+    {"multiply", zmk_blend_span_multiply, ZMK_RGB_FX_BLENDING_MODE_MULTIPLY},
+    {"lighten", zmk_blend_span_lighten, ZMK_RGB_FX_BLENDING_MODE_LIGHTEN},
+    {"darken", zmk_blend_span_darken, ZMK_RGB_FX_BLENDING_MODE_DARKEN},
+    {"screen", zmk_blend_span_screen, ZMK_RGB_FX_BLENDING_MODE_SCREEN},
+    {"subtract", zmk_blend_span_subtract, ZMK_RGB_FX_BLENDING_MODE_SUBTRACT},
+};
+
+static struct zmk_color_rgb base_colors[SPAN_BUFFER_SIZE];
+static struct zmk_color_rgb blend_colors[SPAN_BUFFER_SIZE];
+static struct zmk_color_rgb colors[SPAN_BUFFER_SIZE];
+static struct led_rgb leds[SPAN_BUFFER_SIZE];
+
+static uint32_t rng_state;
+
+static uint16_t next_random(void) {
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 17;
+    rng_state ^= rng_state << 5;
+
+    return rng_state >> 16;
+}
+
+/**
+ * Fills the base and blend colors with random channels, except for the first channels of the span
+ * starting at the given pixel, which pair up every two edge values.
+ */
+static void fill_operands(size_t offset, uint32_t seed) {
+    uint16_t *base = (uint16_t *)base_colors;
+    uint16_t *blend = (uint16_t *)blend_colors;
+    const size_t num_edges = ARRAY_SIZE(edge_values);
+
+    rng_state = seed;
+
+    for (size_t i = 0; i < 3 * SPAN_BUFFER_SIZE; ++i) {
+        const size_t edge = i - 3 * offset;
+
+        if (i >= 3 * offset && edge < num_edges * num_edges) {
+            base[i] = edge_values[edge % num_edges];
+            blend[i] = edge_values[edge / num_edges];
+        } else {
+            base[i] = next_random();
+            blend[i] = next_random();
+        }
+    }
+}
+
+static void fill_guard(struct zmk_color_rgb *buffer, size_t start) {
+    for (size_t i = start; i < SPAN_BUFFER_SIZE; ++i) {
+        buffer[i].r = buffer[i].g = buffer[i].b = GUARD_CHANNEL;
+    }
+}
+
+static void assert_color_equal(const struct zmk_color_rgb *actual,
+                               const struct zmk_color_rgb *expected, const char *kernel,
+                               size_t offset, size_t length, size_t i) {
+    zassert_true(actual->r == expected->r && actual->g == expected->g && actual->b == expected->b,
+                 "%s, offset %u, length %u: pixel %u is %04x %04x %04x instead of %04x %04x %04x",
+                 kernel, (unsigned int)offset, (unsigned int)length, (unsigned int)i, actual->r,
+                 actual->g, actual->b, expected->r, expected->g, expected->b);
+}
+
+static void assert_guard_intact(const struct zmk_color_rgb *buffer, size_t start,
+                                const char *kernel, size_t offset, size_t length) {
+    for (size_t i = start; i < SPAN_BUFFER_SIZE; ++i) {
+        zassert_true(buffer[i].r == GUARD_CHANNEL && buffer[i].g == GUARD_CHANNEL &&
+                         buffer[i].b == GUARD_CHANNEL,
+                     "%s, offset %u, length %u: wrote past the span into pixel %u", kernel,
+                     (unsigned int)offset, (unsigned int)length, (unsigned int)i);
+    }
+}
+
+ZTEST(rgb_fx_simd, test_blend_span_matches_scalar) {
+    for (size_t m = 0; m < ARRAY_SIZE(blend_modes); ++m) {
+        for (size_t offset = 0; offset <= SPAN_MAX_OFFSET; ++offset) {
+            for (size_t length = 0; length <= SPAN_MAX_LENGTH; ++length) {
+                fill_operands(offset, offset * 0x10001 + length + 1);
+
+                memcpy(colors, base_colors, sizeof(colors));
+                fill_guard(colors, offset + length);
+
+                blend_modes[m].blend_span(&colors[offset], NULL, &blend_colors[offset], length);
+
+                for (size_t i = offset; i < offset + length; ++i) {
+                    const struct zmk_color_rgb expected = zmk_apply_blending_mode(
+                        base_colors[i], blend_colors[i], blend_modes[m].mode);
+
+                    assert_color_equal(&colors[i], &expected, blend_modes[m].name, offset, length,
+                                       i - offset);
+                }
+
+                for (size_t i = 0; i < offset; ++i) {
+                    assert_color_equal(&colors[i], &base_colors[i], blend_modes[m].name, offset,
+                                       length, i);
+                }
+
+                assert_guard_intact(colors, offset + length, blend_modes[m].name, offset, length);
+            }
+        }
+    }
+}
+
+ZTEST(rgb_fx_simd, test_blend_span_with_pixel_map) {
+    const size_t length = SPAN_BUFFER_SIZE / 2;
+    zmk_rgb_fx_pixel_idx_t pixel_map[SPAN_BUFFER_SIZE / 2];
+
+    // Every other pixel, in reverse order.
+    for (size_t i = 0; i < length; ++i) {
+        pixel_map[i] = SPAN_BUFFER_SIZE - 1 - 2 * i;
+    }
+
+    for (size_t m = 0; m < ARRAY_SIZE(blend_modes); ++m) {
+        fill_operands(0, m + 1);
+
+        memcpy(colors, base_colors, sizeof(colors));
+
+        blend_modes[m].blend_span(colors, pixel_map, blend_colors, length);
+
+        for (size_t i = 0; i < length; ++i) {
+            const struct zmk_color_rgb expected = zmk_apply_blending_mode(
+                base_colors[pixel_map[i]], blend_colors[i], blend_modes[m].mode);
+
+            assert_color_equal(&colors[pixel_map[i]], &expected, blend_modes[m].name, 0, length,
+                               i);
+        }
+    }
+}
+
+ZTEST(rgb_fx_simd, test_scale_span_matches_scalar) {
+    static const zmk_color_fraction_t fractions[] = {0,      1,      0x1234, 0x7FFF,
+                                                     0x8000, 0xEDCB, 0xFFFE, UINT16_MAX};
+
+    for (size_t f = 0; f < ARRAY_SIZE(fractions); ++f) {
+        const zmk_color_fraction_t fraction = fractions[f];
+
+        for (size_t offset = 0; offset <= SPAN_MAX_OFFSET; ++offset) {
+            for (size_t length = 0; length <= SPAN_MAX_LENGTH; ++length) {
+                fill_operands(offset, offset * 0x10001 + length + 1);
+
+                memcpy(colors, base_colors, sizeof(colors));
+                fill_guard(colors, offset + length);
+
+                zmk_scale_span(&colors[offset], length, fraction);
+
+                for (size_t i = offset; i < offset + length; ++i) {
+                    struct zmk_color_rgb expected;
+
+                    zmk_scale_rgb(&base_colors[i], &expected, fraction);
+
+                    assert_color_equal(&colors[i], &expected, "scale", offset, length, i - offset);
+                }
+
+                assert_guard_intact(colors, offset + length, "scale", offset, length);
+            }
+        }
+    }
+}
+
+ZTEST(rgb_fx_simd, test_rgb_to_led_rgb_span_matches_scalar) {
+    const uint8_t *bytes = (const uint8_t *)leds;
+
+    for (size_t offset = 0; offset <= SPAN_MAX_OFFSET; ++offset) {
+        for (size_t length = 0; length <= SPAN_MAX_LENGTH; ++length) {
+            fill_operands(offset, offset * 0x10001 + length + 1);
+
+            // Without the scratch byte, led_rgb is packed and the narrowing stores whole vectors,
+            // so every byte around the span is checked as well.
+            memset(leds, GUARD_BYTE, sizeof(leds));
+
+            zmk_rgb_to_led_rgb_span(&base_colors[offset], &leds[offset], length);
+
+            for (size_t i = offset; i < offset + length; ++i) {
+                struct led_rgb expected;
+
+                zmk_rgb_to_led_rgb(&base_colors[i], &expected);
+
+                zassert_true(leds[i].r == expected.r && leds[i].g == expected.g &&
+                                 leds[i].b == expected.b,
+                             "offset %u, length %u: pixel %u is %02x %02x %02x instead of "
+                             "%02x %02x %02x",
+                             (unsigned int)offset, (unsigned int)length,
+                             (unsigned int)(i - offset), leds[i].r, leds[i].g, leds[i].b,
+                             expected.r, expected.g, expected.b);
+            }
+
+            for (size_t i = 0; i < offset * sizeof(leds[0]); ++i) {
+                zassert_equal(bytes[i], GUARD_BYTE, "offset %u, length %u: wrote before the span",
+                              (unsigned int)offset, (unsigned int)length);
+            }
+
+            for (size_t i = (offset + length) * sizeof(leds[0]); i < sizeof(leds); ++i) {
+                zassert_equal(bytes[i], GUARD_BYTE, "offset %u, length %u: wrote past the span",
+                              (unsigned int)offset, (unsigned int)length);
+            }
+        }
+    }
+}
+
+ZTEST_SUITE(rgb_fx_simd, NULL, NULL, NULL, NULL, NULL);
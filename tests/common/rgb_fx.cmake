@@ -0,0 +1,36 @@
+# Copyright (c) 2024 Kuba Birecki
+# SPDX-License-Identifier: MIT
+
+# Builds the animation core into a test application, together with the parts of ZMK it depends on:
+# the event manager, the events the effects subscribe to and their linker section.
+# The behavior and the control groups need the rest of ZMK, so tests add only the effects they use.
+#
+# ZMK_APP_DIR is the app directory of a ZMK checkout, by default the one in the west workspace.
+
+if (NOT DEFINED ZMK_APP_DIR AND DEFINED ENV{ZMK_APP_DIR})
+  set(ZMK_APP_DIR $ENV{ZMK_APP_DIR})
+endif()
+
+if (NOT DEFINED ZMK_APP_DIR)
+  find_path(ZMK_APP_DIR include/zmk/event_manager.h
+    PATHS ${ZEPHYR_BASE}/../zmk/app ${ZEPHYR_BASE}/../app
+    NO_DEFAULT_PATH
+  )
+endif()
+
+if (NOT ZMK_APP_DIR)
+  message(FATAL_ERROR "ZMK not found, set ZMK_APP_DIR to the app directory of a ZMK checkout")
+endif()
+
+target_include_directories(app PRIVATE ${ZMK_APP_DIR}/include)
+zephyr_linker_sources(RODATA ${ZMK_APP_DIR}/include/linker/zmk-events.ld)
+
+target_sources(app PRIVATE ${ZMK_APP_DIR}/src/event_manager.c)
+target_sources(app PRIVATE ${ZMK_APP_DIR}/src/events/activity_state_changed.c)
+target_sources(app PRIVATE ${ZMK_APP_DIR}/src/events/position_state_changed.c)
+target_sources(app PRIVATE ${CMAKE_CURRENT_LIST_DIR}/src/zmk.c)
+
+target_include_directories(app PRIVATE ${CMAKE_CURRENT_LIST_DIR}/../../include)
+target_sources(app PRIVATE ${CMAKE_CURRENT_LIST_DIR}/../../src/color.c)
+target_sources(app PRIVATE ${CMAKE_CURRENT_LIST_DIR}/../../src/rgb_fx.c)
+target_sources(app PRIVATE ${CMAKE_CURRENT_LIST_DIR}/../../src/drivers/led_strip_emul.c)
@@ -0,0 +1,10 @@
+/*
+ * Copyright (c) 2024 Kuba Birecki
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <zephyr/logging/log.h>
+
+// Registered by the ZMK application, which isn't part of the tests.
+LOG_MODULE_REGISTER(zmk, CONFIG_ZMK_LOG_LEVEL);
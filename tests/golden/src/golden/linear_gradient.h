@@ -0,0 +1,213 @@
+/*
+ * Copyright (c) 2024 Kuba Birecki
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+/**
+ * Frames of linear_gradient.overlay, recorded with CONFIG_RGB_FX_GOLDEN_RECORD=y.
+ */
+static const uint8_t golden_frames[][RGB_FX_NUM_PIXELS][3] = {
+    /* 0 */
+    {{0xff, 0x00, 0x00}, {0x00, 0xff, 0x11}, {0x22, 0x00, 0xff}, {0xff, 0x33, 0x00},
+     {0x99, 0xff, 0x00}, {0x00, 0x80, 0xff}, {0xff, 0x00, 0x6e}, {0x5d, 0xff, 0x00},
+     {0x00, 0xff, 0xd9}, {0xf3, 0x00, 0xff}, {0xfb, 0xff, 0x00}, {0x00, 0xea, 0xff}},
+    /* 1 */
+    {{0xff, 0x00, 0x19}, {0x08, 0xff, 0x00}, {0x0c, 0x00, 0xff}, {0xff, 0x1d, 0x00},
+     {0xae, 0xff, 0x00}, {0x00, 0x95, 0xff}, {0xff, 0x00, 0x84}, {0x73, 0xff, 0x00},
+     {0x00, 0xff, 0xbf}, {0xd9, 0x00, 0xff}, {0xff, 0xea, 0x00}, {0x00, 0xff, 0xff}},
+    /* 2 */
+    {{0xff, 0x00, 0x37}, {0x26, 0xff, 0x00}, {0x00, 0x15, 0xff}, {0xff, 0x00, 0x00},
+     {0xcc, 0xff, 0x00}, {0x00, 0xb7, 0xff}, {0xff, 0x00, 0xa2}, {0x91, 0xff, 0x00},
+     {0x00, 0xff, 0xa2}, {0xbb, 0x00, 0xff}, {0xff, 0xcc, 0x00}, {0x00, 0xff, 0xdd}},
+    /* 3 */
+    {{0xff, 0x00, 0x55}, {0x44, 0xff, 0x00}, {0x00, 0x33, 0xff}, {0xff, 0x00, 0x22},
+     {0xee, 0xff, 0x00}, {0x00, 0xd5, 0xff}, {0xff, 0x00, 0xbf}, {0xae, 0xff, 0x00},
+     {0x00, 0xff, 0x84}, {0x9d, 0x00, 0xff}, {0xff, 0xae, 0x00}, {0x00, 0xff, 0xbf}},
+    /* 4 */
+    {{0xff, 0x00, 0x77}, {0x62, 0xff, 0x00}, {0x00, 0x51, 0xff}, {0xff, 0x00, 0x40},
+     {0xff, 0xf3, 0x00}, {0x00, 0xf3, 0xff}, {0xff, 0x00, 0xe2}, {0xcc, 0xff, 0x00},
+     {0x00, 0xff, 0x66}, {0x80, 0x00, 0xff}, {0xff, 0x91, 0x00}, {0x00, 0xff, 0xa2}},
+    /* 5 */
+    {{0xff, 0x00, 0x95}, {0x80, 0xff, 0x00}, {0x00, 0x6e, 0xff}, {0xff, 0x00, 0x5d},
+     {0xff, 0xd5, 0x00}, {0x00, 0xff, 0xee}, {0xff, 0x00, 0xff}, {0xee, 0xff, 0x00},
+     {0x00, 0xff, 0x44}, {0x5d, 0x00, 0xff}, {0xff, 0x73, 0x00}, {0x00, 0xff, 0x84}},
+    /* 6 */
+    {{0xff, 0x00, 0xb3}, {0xa2, 0xff, 0x00}, {0x00, 0x91, 0xff}, {0xff, 0x00, 0x7b},
+     {0xff, 0xb7, 0x00}, {0x00, 0xff, 0xd1}, {0xe2, 0x00, 0xff}, {0xff, 0xf3, 0x00},
+     {0x00, 0xff, 0x26}, {0x40, 0x00, 0xff}, {0xff, 0x51, 0x00}, {0x00, 0xff, 0x66}},
+    /* 7 */
+    {{0xff, 0x00, 0xd1}, {0xbf, 0xff, 0x00}, {0x00, 0xae, 0xff}, {0xff, 0x00, 0x9d},
+     {0xff, 0x99, 0x00}, {0x00, 0xff, 0xb3}, {0xc4, 0x00, 0xff}, {0xff, 0xd5, 0x00},
+     {0x00, 0xff, 0x08}, {0x22, 0x00, 0xff}, {0xff, 0x33, 0x00}, {0x00, 0xff, 0x44}},
+    /* 8 */
+    {{0xff, 0x00, 0xee}, {0xdd, 0xff, 0x00}, {0x00, 0xcc, 0xff}, {0xff, 0x00, 0xbb},
+     {0xff, 0x77, 0x00}, {0x00, 0xff, 0x91}, {0xa2, 0x00, 0xff}, {0xff, 0xb7, 0x00},
+     {0x15, 0xff, 0x00}, {0x04, 0x00, 0xff}, {0xff, 0x15, 0x00}, {0x00, 0xff, 0x26}},
+    /* 9 */
+    {{0xf3, 0x00, 0xff}, {0xfb, 0xff, 0x00}, {0x00, 0xea, 0xff}, {0xff, 0x00, 0xd9},
+     {0xff, 0x59, 0x00}, {0x00, 0xff, 0x73}, {0x84, 0x00, 0xff}, {0xff, 0x99, 0x00},
+     {0x37, 0xff, 0x00}, {0x00, 0x1d, 0xff}, {0xff, 0x00, 0x08}, {0x00, 0xff, 0x08}},
+    /* 10 */
+    {{0xd1, 0x00, 0xff}, {0xff, 0xe2, 0x00}, {0x00, 0xff, 0xf7}, {0xff, 0x00, 0xf7},
+     {0xff, 0x3b, 0x00}, {0x00, 0xff, 0x55}, {0x66, 0x00, 0xff}, {0xff, 0x77, 0x00},
+     {0x55, 0xff, 0x00}, {0x00, 0x3b, 0xff}, {0xff, 0x00, 0x2a}, {0x15, 0xff, 0x00}},
+    /* 11 */
+    {{0xb3, 0x00, 0xff}, {0xff, 0xc4, 0x00}, {0x00, 0xff, 0xd9}, {0xea, 0x00, 0xff},
+     {0xff, 0x1d, 0x00}, {0x00, 0xff, 0x37}, {0x48, 0x00, 0xff}, {0xff, 0x59, 0x00},
+     {0x73, 0xff, 0x00}, {0x00, 0x59, 0xff}, {0xff, 0x00, 0x48}, {0x37, 0xff, 0x00}},
+    /* 12 */
+    {{0x95, 0x00, 0xff}, {0xff, 0xa6, 0x00}, {0x00, 0xff, 0xb7}, {0xcc, 0x00, 0xff},
+     {0xff, 0x00, 0x00}, {0x00, 0xff, 0x19}, {0x2a, 0x00, 0xff}, {0xff, 0x3b, 0x00},
+     {0x91, 0xff, 0x00}, {0x00, 0x77, 0xff}, {0xff, 0x00, 0x66}, {0x55, 0xff, 0x00}},
+    /* 13 */
+    {{0x77, 0x00, 0xff}, {0xff, 0x88, 0x00}, {0x00, 0xff, 0x99}, {0xaa, 0x00, 0xff},
+     {0xff, 0x00, 0x22}, {0x08, 0xff, 0x00}, {0x0c, 0x00, 0xff}, {0xff, 0x1d, 0x00},
+     {0xae, 0xff, 0x00}, {0x00, 0x95, 0xff}, {0xff, 0x00, 0x84}, {0x73, 0xff, 0x00}},
+    /* 14 */
+    {{0x59, 0x00, 0xff}, {0xff, 0x6a, 0x00}, {0x00, 0xff, 0x7b}, {0x8c, 0x00, 0xff},
+     {0xff, 0x00, 0x40}, {0x26, 0xff, 0x00}, {0x00, 0x15, 0xff}, {0xff, 0x00, 0x00},
+     {0xcc, 0xff, 0x00}, {0x00, 0xb7, 0xff}, {0xff, 0x00, 0xa2}, {0x91, 0xff, 0x00}},
+    /* 15 */
+    {{0x37, 0x00, 0xff}, {0xff, 0x4c, 0x00}, {0x00, 0xff, 0x5d}, {0x6e, 0x00, 0xff},
+     {0xff, 0x00, 0x5d}, {0x44, 0xff, 0x00}, {0x00, 0x33, 0xff}, {0xff, 0x00, 0x22},
+     {0xee, 0xff, 0x00}, {0x00, 0xd5, 0xff}, {0xff, 0x00, 0xbf}, {0xae, 0xff, 0x00}},
+    /* 16 */
+    {{0x19, 0x00, 0xff}, {0xff, 0x2a, 0x00}, {0x00, 0xff, 0x40}, {0x51, 0x00, 0xff},
+     {0xff, 0x00, 0x7b}, {0x62, 0xff, 0x00}, {0x00, 0x51, 0xff}, {0xff, 0x00, 0x40},
+     {0xff, 0xf3, 0x00}, {0x00, 0xf3, 0xff}, {0xff, 0x00, 0xe2}, {0xcc, 0xff, 0x00}},
+    /* 17 */
+    {{0x00, 0x04, 0xff}, {0xff, 0x0c, 0x00}, {0x00, 0xff, 0x1d}, {0x33, 0x00, 0xff},
+     {0xff, 0x00, 0x9d}, {0x80, 0xff, 0x00}, {0x00, 0x6e, 0xff}, {0xff, 0x00, 0x5d},
+     {0xff, 0xd5, 0x00}, {0x00, 0xff, 0xee}, {0xff, 0x00, 0xff}, {0xee, 0xff, 0x00}},
+    /* 18 */
+    {{0x00, 0x22, 0xff}, {0xff, 0x00, 0x11}, {0x00, 0xff, 0x00}, {0x11, 0x00, 0xff},
+     {0xff, 0x00, 0xbb}, {0xa2, 0xff, 0x00}, {0x00, 0x91, 0xff}, {0xff, 0x00, 0x7b},
+     {0xff, 0xb7, 0x00}, {0x00, 0xff, 0xd1}, {0xe2, 0x00, 0xff}, {0xff, 0xf3, 0x00}},
+    /* 19 */
+    {{0x00, 0x40, 0xff}, {0xff, 0x00, 0x2e}, {0x1d, 0xff, 0x00}, {0x00, 0x0c, 0xff},
+     {0xff, 0x00, 0xd9}, {0xbf, 0xff, 0x00}, {0x00, 0xae, 0xff}, {0xff, 0x00, 0x9d},
+     {0xff, 0x99, 0x00}, {0x00, 0xff, 0xb3}, {0xc4, 0x00, 0xff}, {0xff, 0xd5, 0x00}},
+    /* 20 */
+    {{0x00, 0x62, 0xff}, {0xff, 0x00, 0x51}, {0x3b, 0xff, 0x00}, {0x00, 0x2a, 0xff},
+     {0xff, 0x00, 0xf7}, {0xdd, 0xff, 0x00}, {0x00, 0xcc, 0xff}, {0xff, 0x00, 0xbb},
+     {0xff, 0x77, 0x00}, {0x00, 0xff, 0x91}, {0xa2, 0x00, 0xff}, {0xff, 0xb7, 0x00}},
+    /* 21 */
+    {{0x00, 0x80, 0xff}, {0xff, 0x00, 0x6e}, {0x5d, 0xff, 0x00}, {0x00, 0x48, 0xff},
+     {0xea, 0x00, 0xff}, {0xfb, 0xff, 0x00}, {0x00, 0xea, 0xff}, {0xff, 0x00, 0xd9},
+     {0xff, 0x59, 0x00}, {0x00, 0xff, 0x73}, {0x84, 0x00, 0xff}, {0xff, 0x99, 0x00}},
+    /* 22 */
+    {{0x00, 0x9d, 0xff}, {0xff, 0x00, 0x8c}, {0x7b, 0xff, 0x00}, {0x00, 0x66, 0xff},
+     {0xcc, 0x00, 0xff}, {0xff, 0xe2, 0x00}, {0x00, 0xff, 0xf7}, {0xff, 0x00, 0xf7},
+     {0xff, 0x3b, 0x00}, {0x00, 0xff, 0x55}, {0x66, 0x00, 0xff}, {0xff, 0x77, 0x00}},
+    /* 23 */
+    {{0x00, 0xbb, 0xff}, {0xff, 0x00, 0xaa}, {0x99, 0xff, 0x00}, {0x00, 0x88, 0xff},
+     {0xaa, 0x00, 0xff}, {0xff, 0xc4, 0x00}, {0x00, 0xff, 0xd9}, {0xea, 0x00, 0xff},
+     {0xff, 0x1d, 0x00}, {0x00, 0xff, 0x37}, {0x48, 0x00, 0xff}, {0xff, 0x59, 0x00}},
+    /* 24 */
+    {{0x00, 0xdd, 0xff}, {0xff, 0x00, 0xc8}, {0xb7, 0xff, 0x00}, {0x00, 0xa6, 0xff},
+     {0x8c, 0x00, 0xff}, {0xff, 0xa6, 0x00}, {0x00, 0xff, 0xb7}, {0xcc, 0x00, 0xff},
+     {0xff, 0x00, 0x00}, {0x00, 0xff, 0x19}, {0x2a, 0x00, 0xff}, {0xff, 0x3b, 0x00}},
+    /* 25 */
+    {{0x00, 0xfb, 0xff}, {0xff, 0x00, 0xe6}, {0xd5, 0xff, 0x00}, {0x00, 0xc4, 0xff},
+     {0x6e, 0x00, 0xff}, {0xff, 0x88, 0x00}, {0x00, 0xff, 0x99}, {0xaa, 0x00, 0xff},
+     {0xff, 0x00, 0x22}, {0x08, 0xff, 0x00}, {0x0c, 0x00, 0xff}, {0xff, 0x1d, 0x00}},
+    /* 26 */
+    {{0x00, 0xff, 0xe6}, {0xf7, 0x00, 0xff}, {0xf7, 0xff, 0x00}, {0x00, 0xe2, 0xff},
+     {0x51, 0x00, 0xff}, {0xff, 0x6a, 0x00}, {0x00, 0xff, 0x7b}, {0x8c, 0x00, 0xff},
+     {0xff, 0x00, 0x40}, {0x26, 0xff, 0x00}, {0x00, 0x15, 0xff}, {0xff, 0x00, 0x00}},
+    /* 27 */
+    {{0x00, 0xff, 0xc8}, {0xd9, 0x00, 0xff}, {0xff, 0xea, 0x00}, {0x00, 0xff, 0xff},
+     {0x33, 0x00, 0xff}, {0xff, 0x4c, 0x00}, {0x00, 0xff, 0x5d}, {0x6e, 0x00, 0xff},
+     {0xff, 0x00, 0x5d}, {0x44, 0xff, 0x00}, {0x00, 0x33, 0xff}, {0xff, 0x00, 0x22}},
+    /* 28 */
+    {{0x00, 0xff, 0xaa}, {0xbb, 0x00, 0xff}, {0xff, 0xcc, 0x00}, {0x00, 0xff, 0xdd},
+     {0x11, 0x00, 0xff}, {0xff, 0x2a, 0x00}, {0x00, 0xff, 0x40}, {0x51, 0x00, 0xff},
+     {0xff, 0x00, 0x7b}, {0x62, 0xff, 0x00}, {0x00, 0x51, 0xff}, {0xff, 0x00, 0x40}},
+    /* 29 */
+    {{0x00, 0xff, 0x8c}, {0x9d, 0x00, 0xff}, {0xff, 0xae, 0x00}, {0x00, 0xff, 0xbf},
+     {0x00, 0x0c, 0xff}, {0xff, 0x0c, 0x00}, {0x00, 0xff, 0x1d}, {0x33, 0x00, 0xff},
+     {0xff, 0x00, 0x9d}, {0x80, 0xff, 0x00}, {0x00, 0x6e, 0xff}, {0xff, 0x00, 0x5d}},
+    /* 30 */
+    {{0x00, 0xff, 0x6a}, {0x80, 0x00, 0xff}, {0xff, 0x91, 0x00}, {0x00, 0xff, 0xa2},
+     {0x00, 0x2a, 0xff}, {0xff, 0x00, 0x11}, {0x00, 0xff, 0x00}, {0x11, 0x00, 0xff},
+     {0xff, 0x00, 0xbb}, {0xa2, 0xff, 0x00}, {0x00, 0x91, 0xff}, {0xff, 0x00, 0x7b}},
+    /* 31 */
+    {{0x00, 0xff, 0x4c}, {0x5d, 0x00, 0xff}, {0xff, 0x73, 0x00}, {0x00, 0xff, 0x84},
+     {0x00, 0x48, 0xff}, {0xff, 0x00, 0x2e}, {0x1d, 0xff, 0x00}, {0x00, 0x0c, 0xff},
+     {0xff, 0x00, 0xd9}, {0xbf, 0xff, 0x00}, {0x00, 0xae, 0xff}, {0xff, 0x00, 0x9d}},
+    /* 32 */
+    {{0x00, 0xff, 0x2e}, {0x40, 0x00, 0xff}, {0xff, 0x51, 0x00}, {0x00, 0xff, 0x66},
+     {0x00, 0x66, 0xff}, {0xff, 0x00, 0x51}, {0x3b, 0xff, 0x00}, {0x00, 0x2a, 0xff},
+     {0xff, 0x00, 0xf7}, {0xdd, 0xff, 0x00}, {0x00, 0xcc, 0xff}, {0xff, 0x00, 0xbb}},
+    /* 33 */
+    {{0x00, 0xff, 0x11}, {0x22, 0x00, 0xff}, {0xff, 0x33, 0x00}, {0x00, 0xff, 0x44},
+     {0x00, 0x88, 0xff}, {0xff, 0x00, 0x6e}, {0x5d, 0xff, 0x00}, {0x00, 0x48, 0xff},
+     {0xea, 0x00, 0xff}, {0xfb, 0xff, 0x00}, {0x00, 0xea, 0xff}, {0xff, 0x00, 0xd9}},
+    /* 34 */
+    {{0x11, 0xff, 0x00}, {0x04, 0x00, 0xff}, {0xff, 0x15, 0x00}, {0x00, 0xff, 0x26},
+     {0x00, 0xa6, 0xff}, {0xff, 0x00, 0x8c}, {0x7b, 0xff, 0x00}, {0x00, 0x66, 0xff},
+     {0xcc, 0x00, 0xff}, {0xff, 0xe2, 0x00}, {0x00, 0xff, 0xf7}, {0xff, 0x00, 0xf7}},
+    /* 35 */
+    {{0x2e, 0xff, 0x00}, {0x00, 0x1d, 0xff}, {0xff, 0x00, 0x08}, {0x00, 0xff, 0x08},
+     {0x00, 0xc4, 0xff}, {0xff, 0x00, 0xaa}, {0x99, 0xff, 0x00}, {0x00, 0x88, 0xff},
+     {0xaa, 0x00, 0xff}, {0xff, 0xc4, 0x00}, {0x00, 0xff, 0xd9}, {0xea, 0x00, 0xff}},
+    /* 36 */
+    {{0x4c, 0xff, 0x00}, {0x00, 0x3b, 0xff}, {0xff, 0x00, 0x2a}, {0x15, 0xff, 0x00},
+     {0x00, 0xe2, 0xff}, {0xff, 0x00, 0xc8}, {0xb7, 0xff, 0x00}, {0x00, 0xa6, 0xff},
+     {0x8c, 0x00, 0xff}, {0xff, 0xa6, 0x00}, {0x00, 0xff, 0xb7}, {0xcc, 0x00, 0xff}},
+    /* 37 */
+    {{0x6a, 0xff, 0x00}, {0x00, 0x59, 0xff}, {0xff, 0x00, 0x48}, {0x37, 0xff, 0x00},
+     {0x00, 0xff, 0xff}, {0xff, 0x00, 0xe6}, {0xd5, 0xff, 0x00}, {0x00, 0xc4, 0xff},
+     {0x6e, 0x00, 0xff}, {0xff, 0x88, 0x00}, {0x00, 0xff, 0x99}, {0xaa, 0x00, 0xff}},
+    /* 38 */
+    {{0x88, 0xff, 0x00}, {0x00, 0x77, 0xff}, {0xff, 0x00, 0x66}, {0x55, 0xff, 0x00},
+     {0x00, 0xff, 0xdd}, {0xf7, 0x00, 0xff}, {0xf7, 0xff, 0x00}, {0x00, 0xe2, 0xff},
+     {0x51, 0x00, 0xff}, {0xff, 0x6a, 0x00}, {0x00, 0xff, 0x7b}, {0x8c, 0x00, 0xff}},
+    /* 39 */
+    {{0xa6, 0xff, 0x00}, {0x00, 0x95, 0xff}, {0xff, 0x00, 0x84}, {0x73, 0xff, 0x00},
+     {0x00, 0xff, 0xbf}, {0xd9, 0x00, 0xff}, {0xff, 0xea, 0x00}, {0x00, 0xff, 0xff},
+     {0x33, 0x00, 0xff}, {0xff, 0x4c, 0x00}, {0x00, 0xff, 0x5d}, {0x6e, 0x00, 0xff}},
+    /* 40 */
+    {{0xc8, 0xff, 0x00}, {0x00, 0xb7, 0xff}, {0xff, 0x00, 0xa2}, {0x91, 0xff, 0x00},
+     {0x00, 0xff, 0xa2}, {0xbb, 0x00, 0xff}, {0xff, 0xcc, 0x00}, {0x00, 0xff, 0xdd},
+     {0x11, 0x00, 0xff}, {0xff, 0x2a, 0x00}, {0x00, 0xff, 0x40}, {0x51, 0x00, 0xff}},
+    /* 41 */
+    {{0xe6, 0xff, 0x00}, {0x00, 0xd5, 0xff}, {0xff, 0x00, 0xbf}, {0xae, 0xff, 0x00},
+     {0x00, 0xff, 0x84}, {0x9d, 0x00, 0xff}, {0xff, 0xae, 0x00}, {0x00, 0xff, 0xbf},
+     {0x00, 0x0c, 0xff}, {0xff, 0x0c, 0x00}, {0x00, 0xff, 0x1d}, {0x33, 0x00, 0xff}},
+    /* 42 */
+    {{0xff, 0xfb, 0x00}, {0x00, 0xf3, 0xff}, {0xff, 0x00, 0xe2}, {0xcc, 0xff, 0x00},
+     {0x00, 0xff, 0x66}, {0x80, 0x00, 0xff}, {0xff, 0x91, 0x00}, {0x00, 0xff, 0xa2},
+     {0x00, 0x2a, 0xff}, {0xff, 0x00, 0x11}, {0x00, 0xff, 0x00}, {0x11, 0x00, 0xff}},
+    /* 43 */
+    {{0xff, 0xdd, 0x00}, {0x00, 0xff, 0xee}, {0xff, 0x00, 0xff}, {0xee, 0xff, 0x00},
+     {0x00, 0xff, 0x44}, {0x5d, 0x00, 0xff}, {0xff, 0x73, 0x00}, {0x00, 0xff, 0x84},
+     {0x00, 0x48, 0xff}, {0xff, 0x00, 0x2e}, {0x1d, 0xff, 0x00}, {0x00, 0x0c, 0xff}},
+    /* 44 */
+    {{0xff, 0xbf, 0x00}, {0x00, 0xff, 0xd1}, {0xe2, 0x00, 0xff}, {0xff, 0xf3, 0x00},
+     {0x00, 0xff, 0x26}, {0x40, 0x00, 0xff}, {0xff, 0x51, 0x00}, {0x00, 0xff, 0x66},
+     {0x00, 0x66, 0xff}, {0xff, 0x00, 0x51}, {0x3b, 0xff, 0x00}, {0x00, 0x2a, 0xff}},
+    /* 45 */
+    {{0xff, 0x9d, 0x00}, {0x00, 0xff, 0xb3}, {0xc4, 0x00, 0xff}, {0xff, 0xd5, 0x00},
+     {0x00, 0xff, 0x08}, {0x22, 0x00, 0xff}, {0xff, 0x33, 0x00}, {0x00, 0xff, 0x44},
+     {0x00, 0x88, 0xff}, {0xff, 0x00, 0x6e}, {0x5d, 0xff, 0x00}, {0x00, 0x48, 0xff}},
+    /* 46 */
+    {{0xff, 0x80, 0x00}, {0x00, 0xff, 0x91}, {0xa2, 0x00, 0xff}, {0xff, 0xb7, 0x00},
+     {0x15, 0xff, 0x00}, {0x04, 0x00, 0xff}, {0xff, 0x15, 0x00}, {0x00, 0xff, 0x26},
+     {0x00, 0xa6, 0xff}, {0xff, 0x00, 0x8c}, {0x7b, 0xff, 0x00}, {0x00, 0x66, 0xff}},
+    /* 47 */
+    {{0xff, 0x62, 0x00}, {0x00, 0xff, 0x73}, {0x84, 0x00, 0xff}, {0xff, 0x99, 0x00},
+     {0x37, 0xff, 0x00}, {0x00, 0x1d, 0xff}, {0xff, 0x00, 0x08}, {0x00, 0xff, 0x08},
+     {0x00, 0xc4, 0xff}, {0xff, 0x00, 0xaa}, {0x99, 0xff, 0x00}, {0x00, 0x88, 0xff}},
+    /* 48 */
+    {{0xff, 0x44, 0x00}, {0x00, 0xff, 0x55}, {0x66, 0x00, 0xff}, {0xff, 0x77, 0x00},
+     {0x55, 0xff, 0x00}, {0x00, 0x3b, 0xff}, {0xff, 0x00, 0x2a}, {0x15, 0xff, 0x00},
+     {0x00, 0xe2, 0xff}, {0xff, 0x00, 0xc8}, {0xb7, 0xff, 0x00}, {0x00, 0xa6, 0xff}},
+    /* 49 */
+    {{0xff, 0x26, 0x00}, {0x00, 0xff, 0x37}, {0x48, 0x00, 0xff}, {0xff, 0x59, 0x00},
+     {0x73, 0xff, 0x00}, {0x00, 0x59, 0xff}, {0xff, 0x00, 0x48}, {0x37, 0xff, 0x00},
+     {0x00, 0xff, 0xff}, {0xff, 0x00, 0xe6}, {0xd5, 0xff, 0x00}, {0x00, 0xc4, 0xff}},
+};
@@ -0,0 +1,313 @@
+/*
+ * Copyright (c) 2024 Kuba Birecki
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+/**
+ * Frames of linear_gradient_offset.overlay, recorded with CONFIG_RGB_FX_GOLDEN_RECORD=y.
+ */
+static const uint8_t golden_frames[][RGB_FX_NUM_PIXELS][3] = {
+    /* 0 */
+    {{0xff, 0xae, 0x51}, {0xff, 0x5d, 0xa2}, {0xff, 0x95, 0x6a}, {0xff, 0x7b, 0x84},
+     {0xff, 0x6e, 0x91}, {0xff, 0x80, 0x7f}, {0xff, 0x8c, 0x73}, {0xff, 0x62, 0x9d},
+     {0xff, 0x6e, 0x91}, {0xff, 0xa2, 0x5d}, {0xff, 0x51, 0xae}, {0xff, 0xbf, 0x40}},
+    /* 1 */
+    {{0xff, 0xb7, 0x48}, {0xff, 0x55, 0xaa}, {0xff, 0x9d, 0x62}, {0xff, 0x73, 0x8c},
+     {0xff, 0x66, 0x99}, {0xff, 0x88, 0x77}, {0xff, 0x84, 0x7b}, {0xff, 0x6a, 0x95},
+     {0xff, 0x77, 0x88}, {0xff, 0x99, 0x66}, {0xff, 0x59, 0xa6}, {0xff, 0xb7, 0x48}},
+    /* 2 */
+    {{0xff, 0xbb, 0x44}, {0xff, 0x51, 0xae}, {0xff, 0xa2, 0x5d}, {0xff, 0x6e, 0x91},
+     {0xff, 0x62, 0x9d}, {0xff, 0x8c, 0x73}, {0xff, 0x7f, 0x80}, {0xff, 0x6e, 0x91},
+     {0xff, 0x7b, 0x84}, {0xff, 0x95, 0x6a}, {0xff, 0x5d, 0xa2}, {0xff, 0xb3, 0x4c}},
+    /* 3 */
+    {{0xff, 0xc0, 0x3f}, {0xff, 0x4c, 0xb3}, {0xff, 0xa6, 0x59}, {0xff, 0x6a, 0x95},
+     {0xff, 0x5d, 0xa2}, {0xff, 0x91, 0x6e}, {0xff, 0x7b, 0x84}, {0xff, 0x73, 0x8c},
+     {0xff, 0x80, 0x7f}, {0xff, 0x91, 0x6e}, {0xff, 0x62, 0x9d}, {0xff, 0xae, 0x51}},
+    /* 4 */
+    {{0xff, 0xc4, 0x3b}, {0xff, 0x48, 0xb7}, {0xff, 0xaa, 0x55}, {0xff, 0x66, 0x99},
+     {0xff, 0x59, 0xa6}, {0xff, 0x95, 0x6a}, {0xff, 0x77, 0x88}, {0xff, 0x77, 0x88},
+     {0xff, 0x84, 0x7b}, {0xff, 0x8c, 0x73}, {0xff, 0x66, 0x99}, {0xff, 0xaa, 0x55}},
+    /* 5 */
+    {{0xff, 0xc8, 0x37}, {0xff, 0x44, 0xbb}, {0xff, 0xae, 0x51}, {0xff, 0x62, 0x9d},
+     {0xff, 0x55, 0xaa}, {0xff, 0x99, 0x66}, {0xff, 0x73, 0x8c}, {0xff, 0x7b, 0x84},
+     {0xff, 0x88, 0x77}, {0xff, 0x88, 0x77}, {0xff, 0x6a, 0x95}, {0xff, 0xa6, 0x59}},
+    /* 6 */
+    {{0xff, 0xd1, 0x2e}, {0xff, 0x3b, 0xc4}, {0xff, 0xb7, 0x48}, {0xff, 0x59, 0xa6},
+     {0xff, 0x4c, 0xb3}, {0xff, 0xa2, 0x5d}, {0xff, 0x6a, 0x95}, {0xff, 0x84, 0x7b},
+     {0xff, 0x91, 0x6e}, {0xff, 0x7f, 0x80}, {0xff, 0x73, 0x8c}, {0xff, 0x9d, 0x62}},
+    /* 7 */
+    {{0xff, 0xd5, 0x2a}, {0xff, 0x37, 0xc8}, {0xff, 0xbb, 0x44}, {0xff, 0x55, 0xaa},
+     {0xff, 0x48, 0xb7}, {0xff, 0xa6, 0x59}, {0xff, 0x66, 0x99}, {0xff, 0x88, 0x77},
+     {0xff, 0x95, 0x6a}, {0xff, 0x7b, 0x84}, {0xff, 0x77, 0x88}, {0xff, 0x99, 0x66}},
+    /* 8 */
+    {{0xff, 0xd9, 0x26}, {0xff, 0x33, 0xcc}, {0xff, 0xc0, 0x3f}, {0xff, 0x51, 0xae},
+     {0xff, 0x44, 0xbb}, {0xff, 0xaa, 0x55}, {0xff, 0x62, 0x9d}, {0xff, 0x8c, 0x73},
+     {0xff, 0x99, 0x66}, {0xff, 0x77, 0x88}, {0xff, 0x7b, 0x84}, {0xff, 0x95, 0x6a}},
+    /* 9 */
+    {{0xff, 0xdd, 0x22}, {0xff, 0x2e, 0xd1}, {0xff, 0xc4, 0x3b}, {0xff, 0x4c, 0xb3},
+     {0xff, 0x3f, 0xc0}, {0xff, 0xae, 0x51}, {0xff, 0x5d, 0xa2}, {0xff, 0x91, 0x6e},
+     {0xff, 0x9d, 0x62}, {0xff, 0x73, 0x8c}, {0xff, 0x80, 0x7f}, {0xff, 0x91, 0x6e}},
+    /* 10 */
+    {{0xff, 0xe2, 0x1d}, {0xff, 0x2a, 0xd5}, {0xff, 0xc8, 0x37}, {0xff, 0x48, 0xb7},
+     {0xff, 0x3b, 0xc4}, {0xff, 0xb3, 0x4c}, {0xff, 0x59, 0xa6}, {0xff, 0x95, 0x6a},
+     {0xff, 0xa2, 0x5d}, {0xff, 0x6e, 0x91}, {0xff, 0x84, 0x7b}, {0xff, 0x8c, 0x73}},
+    /* 11 */
+    {{0xff, 0xea, 0x15}, {0xff, 0x22, 0xdd}, {0xff, 0xd1, 0x2e}, {0xff, 0x3f, 0xc0},
+     {0xff, 0x33, 0xcc}, {0xff, 0xbb, 0x44}, {0xff, 0x51, 0xae}, {0xff, 0x9d, 0x62},
+     {0xff, 0xaa, 0x55}, {0xff, 0x66, 0x99}, {0xff, 0x8c, 0x73}, {0xff, 0x84, 0x7b}},
+    /* 12 */
+    {{0xff, 0xee, 0x11}, {0xff, 0x1d, 0xe2}, {0xff, 0xd5, 0x2a}, {0xff, 0x3b, 0xc4},
+     {0xff, 0x2e, 0xd1}, {0xff, 0xc0, 0x3f}, {0xff, 0x4c, 0xb3}, {0xff, 0xa2, 0x5d},
+     {0xff, 0xae, 0x51}, {0xff, 0x62, 0x9d}, {0xff, 0x91, 0x6e}, {0xff, 0x7f, 0x80}},
+    /* 13 */
+    {{0xff, 0xf3, 0x0c}, {0xff, 0x19, 0xe6}, {0xff, 0xd9, 0x26}, {0xff, 0x37, 0xc8},
+     {0xff, 0x2a, 0xd5}, {0xff, 0xc4, 0x3b}, {0xff, 0x48, 0xb7}, {0xff, 0xa6, 0x59},
+     {0xff, 0xb3, 0x4c}, {0xff, 0x5d, 0xa2}, {0xff, 0x95, 0x6a}, {0xff, 0x7b, 0x84}},
+    /* 14 */
+    {{0xff, 0xf7, 0x08}, {0xff, 0x15, 0xea}, {0xff, 0xdd, 0x22}, {0xff, 0x33, 0xcc},
+     {0xff, 0x26, 0xd9}, {0xff, 0xc8, 0x37}, {0xff, 0x44, 0xbb}, {0xff, 0xaa, 0x55},
+     {0xff, 0xb7, 0x48}, {0xff, 0x59, 0xa6}, {0xff, 0x99, 0x66}, {0xff, 0x77, 0x88}},
+    /* 15 */
+    {{0xff, 0xfb, 0x04}, {0xff, 0x11, 0xee}, {0xff, 0xe2, 0x1d}, {0xff, 0x2e, 0xd1},
+     {0xff, 0x22, 0xdd}, {0xff, 0xcc, 0x33}, {0xff, 0x3f, 0xc0}, {0xff, 0xae, 0x51},
+     {0xff, 0xbb, 0x44}, {0xff, 0x55, 0xaa}, {0xff, 0x9d, 0x62}, {0xff, 0x73, 0x8c}},
+    /* 16 */
+    {{0xff, 0xfb, 0x04}, {0xff, 0x08, 0xf7}, {0xff, 0xea, 0x15}, {0xff, 0x26, 0xd9},
+     {0xff, 0x19, 0xe6}, {0xff, 0xd5, 0x2a}, {0xff, 0x37, 0xc8}, {0xff, 0xb7, 0x48},
+     {0xff, 0xc4, 0x3b}, {0xff, 0x4c, 0xb3}, {0xff, 0xa6, 0x59}, {0xff, 0x6a, 0x95}},
+    /* 17 */
+    {{0xff, 0xf7, 0x08}, {0xff, 0x04, 0xfb}, {0xff, 0xee, 0x11}, {0xff, 0x22, 0xdd},
+     {0xff, 0x15, 0xea}, {0xff, 0xd9, 0x26}, {0xff, 0x33, 0xcc}, {0xff, 0xbb, 0x44},
+     {0xff, 0xc8, 0x37}, {0xff, 0x48, 0xb7}, {0xff, 0xaa, 0x55}, {0xff, 0x66, 0x99}},
+    /* 18 */
+    {{0xff, 0xf3, 0x0c}, {0xff, 0x00, 0xff}, {0xff, 0xf3, 0x0c}, {0xff, 0x1d, 0xe2},
+     {0xff, 0x11, 0xee}, {0xff, 0xdd, 0x22}, {0xff, 0x2e, 0xd1}, {0xff, 0xc0, 0x3f},
+     {0xff, 0xcc, 0x33}, {0xff, 0x44, 0xbb}, {0xff, 0xae, 0x51}, {0xff, 0x62, 0x9d}},
+    /* 19 */
+    {{0xff, 0xee, 0x11}, {0xff, 0x04, 0xfb}, {0xff, 0xf7, 0x08}, {0xff, 0x19, 0xe6},
+     {0xff, 0x0c, 0xf3}, {0xff, 0xe2, 0x1d}, {0xff, 0x2a, 0xd5}, {0xff, 0xc4, 0x3b},
+     {0xff, 0xd1, 0x2e}, {0xff, 0x3f, 0xc0}, {0xff, 0xb3, 0x4c}, {0xff, 0x5d, 0xa2}},
+    /* 20 */
+    {{0xff, 0xea, 0x15}, {0xff, 0x08, 0xf7}, {0xff, 0xfb, 0x04}, {0xff, 0x15, 0xea},
+     {0xff, 0x08, 0xf7}, {0xff, 0xe6, 0x19}, {0xff, 0x26, 0xd9}, {0xff, 0xc8, 0x37},
+     {0xff, 0xd5, 0x2a}, {0xff, 0x3b, 0xc4}, {0xff, 0xb7, 0x48}, {0xff, 0x59, 0xa6}},
+    /* 21 */
+    {{0xff, 0xe2, 0x1d}, {0xff, 0x11, 0xee}, {0xff, 0xfb, 0x04}, {0xff, 0x0c, 0xf3},
+     {0xff, 0x00, 0xff}, {0xff, 0xee, 0x11}, {0xff, 0x1d, 0xe2}, {0xff, 0xd1, 0x2e},
+     {0xff, 0xdd, 0x22}, {0xff, 0x33, 0xcc}, {0xff, 0xc0, 0x3f}, {0xff, 0x51, 0xae}},
+    /* 22 */
+    {{0xff, 0xdd, 0x22}, {0xff, 0x15, 0xea}, {0xff, 0xf7, 0x08}, {0xff, 0x08, 0xf7},
+     {0xff, 0x04, 0xfb}, {0xff, 0xf3, 0x0c}, {0xff, 0x19, 0xe6}, {0xff, 0xd5, 0x2a},
+     {0xff, 0xe2, 0x1d}, {0xff, 0x2e, 0xd1}, {0xff, 0xc4, 0x3b}, {0xff, 0x4c, 0xb3}},
+    /* 23 */
+    {{0xff, 0xd9, 0x26}, {0xff, 0x19, 0xe6}, {0xff, 0xf3, 0x0c}, {0xff, 0x04, 0xfb},
+     {0xff, 0x08, 0xf7}, {0xff, 0xf7, 0x08}, {0xff, 0x15, 0xea}, {0xff, 0xd9, 0x26},
+     {0xff, 0xe6, 0x19}, {0xff, 0x2a, 0xd5}, {0xff, 0xc8, 0x37}, {0xff, 0x48, 0xb7}},
+    /* 24 */
+    {{0xff, 0xd5, 0x2a}, {0xff, 0x1d, 0xe2}, {0xff, 0xee, 0x11}, {0xff, 0x00, 0xff},
+     {0xff, 0x0c, 0xf3}, {0xff, 0xfb, 0x04}, {0xff, 0x11, 0xee}, {0xff, 0xdd, 0x22},
+     {0xff, 0xea, 0x15}, {0xff, 0x26, 0xd9}, {0xff, 0xcc, 0x33}, {0xff, 0x44, 0xbb}},
+    /* 25 */
+    {{0xff, 0xd1, 0x2e}, {0xff, 0x22, 0xdd}, {0xff, 0xea, 0x15}, {0xff, 0x04, 0xfb},
+     {0xff, 0x11, 0xee}, {0xff, 0xff, 0x00}, {0xff, 0x0c, 0xf3}, {0xff, 0xe2, 0x1d},
+     {0xff, 0xee, 0x11}, {0xff, 0x22, 0xdd}, {0xff, 0xd1, 0x2e}, {0xff, 0x3f, 0xc0}},
+    /* 26 */
+    {{0xff, 0xc8, 0x37}, {0xff, 0x2a, 0xd5}, {0xff, 0xe2, 0x1d}, {0xff, 0x0c, 0xf3},
+     {0xff, 0x19, 0xe6}, {0xff, 0xf7, 0x08}, {0xff, 0x04, 0xfb}, {0xff, 0xea, 0x15},
+     {0xff, 0xf7, 0x08}, {0xff, 0x19, 0xe6}, {0xff, 0xd9, 0x26}, {0xff, 0x37, 0xc8}},
+    /* 27 */
+    {{0xff, 0xc4, 0x3b}, {0xff, 0x2e, 0xd1}, {0xff, 0xdd, 0x22}, {0xff, 0x11, 0xee},
+     {0xff, 0x1d, 0xe2}, {0xff, 0xf3, 0x0c}, {0xff, 0x00, 0xff}, {0xff, 0xee, 0x11},
+     {0xff, 0xfb, 0x04}, {0xff, 0x15, 0xea}, {0xff, 0xdd, 0x22}, {0xff, 0x33, 0xcc}},
+    /* 28 */
+    {{0xff, 0xbf, 0x40}, {0xff, 0x33, 0xcc}, {0xff, 0xd9, 0x26}, {0xff, 0x15, 0xea},
+     {0xff, 0x22, 0xdd}, {0xff, 0xee, 0x11}, {0xff, 0x04, 0xfb}, {0xff, 0xf3, 0x0c},
+     {0xff, 0xff, 0x00}, {0xff, 0x11, 0xee}, {0xff, 0xe2, 0x1d}, {0xff, 0x2e, 0xd1}},
+    /* 29 */
+    {{0xff, 0xbb, 0x44}, {0xff, 0x37, 0xc8}, {0xff, 0xd5, 0x2a}, {0xff, 0x19, 0xe6},
+     {0xff, 0x26, 0xd9}, {0xff, 0xea, 0x15}, {0xff, 0x08, 0xf7}, {0xff, 0xf7, 0x08},
+     {0xff, 0xfb, 0x04}, {0xff, 0x0c, 0xf3}, {0xff, 0xe6, 0x19}, {0xff, 0x2a, 0xd5}},
+    /* 30 */
+    {{0xff, 0xb7, 0x48}, {0xff, 0x3b, 0xc4}, {0xff, 0xd1, 0x2e}, {0xff, 0x1d, 0xe2},
+     {0xff, 0x2a, 0xd5}, {0xff, 0xe6, 0x19}, {0xff, 0x0c, 0xf3}, {0xff, 0xfb, 0x04},
+     {0xff, 0xf7, 0x08}, {0xff, 0x08, 0xf7}, {0xff, 0xea, 0x15}, {0xff, 0x26, 0xd9}},
+    /* 31 */
+    {{0xff, 0xae, 0x51}, {0xff, 0x44, 0xbb}, {0xff, 0xc8, 0x37}, {0xff, 0x26, 0xd9},
+     {0xff, 0x33, 0xcc}, {0xff, 0xdd, 0x22}, {0xff, 0x15, 0xea}, {0xff, 0xfb, 0x04},
+     {0xff, 0xee, 0x11}, {0xff, 0x00, 0xff}, {0xff, 0xf3, 0x0c}, {0xff, 0x1d, 0xe2}},
+    /* 32 */
+    {{0xff, 0xaa, 0x55}, {0xff, 0x48, 0xb7}, {0xff, 0xc4, 0x3b}, {0xff, 0x2a, 0xd5},
+     {0xff, 0x37, 0xc8}, {0xff, 0xd9, 0x26}, {0xff, 0x19, 0xe6}, {0xff, 0xf7, 0x08},
+     {0xff, 0xea, 0x15}, {0xff, 0x04, 0xfb}, {0xff, 0xf7, 0x08}, {0xff, 0x19, 0xe6}},
+    /* 33 */
+    {{0xff, 0xa6, 0x59}, {0xff, 0x4c, 0xb3}, {0xff, 0xbf, 0x40}, {0xff, 0x2e, 0xd1},
+     {0xff, 0x3b, 0xc4}, {0xff, 0xd5, 0x2a}, {0xff, 0x1d, 0xe2}, {0xff, 0xf3, 0x0c},
+     {0xff, 0xe6, 0x19}, {0xff, 0x08, 0xf7}, {0xff, 0xfb, 0x04}, {0xff, 0x15, 0xea}},
+    /* 34 */
+    {{0xff, 0xa2, 0x5d}, {0xff, 0x51, 0xae}, {0xff, 0xbb, 0x44}, {0xff, 0x33, 0xcc},
+     {0xff, 0x40, 0xbf}, {0xff, 0xd1, 0x2e}, {0xff, 0x22, 0xdd}, {0xff, 0xee, 0x11},
+     {0xff, 0xe2, 0x1d}, {0xff, 0x0c, 0xf3}, {0xff, 0xff, 0x00}, {0xff, 0x11, 0xee}},
+    /* 35 */
+    {{0xff, 0x9d, 0x62}, {0xff, 0x55, 0xaa}, {0xff, 0xb7, 0x48}, {0xff, 0x37, 0xc8},
+     {0xff, 0x44, 0xbb}, {0xff, 0xcc, 0x33}, {0xff, 0x26, 0xd9}, {0xff, 0xea, 0x15},
+     {0xff, 0xdd, 0x22}, {0xff, 0x11, 0xee}, {0xff, 0xfb, 0x04}, {0xff, 0x0c, 0xf3}},
+    /* 36 */
+    {{0xff, 0x95, 0x6a}, {0xff, 0x5d, 0xa2}, {0xff, 0xae, 0x51}, {0xff, 0x40, 0xbf},
+     {0xff, 0x4c, 0xb3}, {0xff, 0xc4, 0x3b}, {0xff, 0x2e, 0xd1}, {0xff, 0xe2, 0x1d},
+     {0xff, 0xd5, 0x2a}, {0xff, 0x19, 0xe6}, {0xff, 0xf3, 0x0c}, {0xff, 0x04, 0xfb}},
+    /* 37 */
+    {{0xff, 0x91, 0x6e}, {0xff, 0x62, 0x9d}, {0xff, 0xaa, 0x55}, {0xff, 0x44, 0xbb},
+     {0xff, 0x51, 0xae}, {0xff, 0xbf, 0x40}, {0xff, 0x33, 0xcc}, {0xff, 0xdd, 0x22},
+     {0xff, 0xd1, 0x2e}, {0xff, 0x1d, 0xe2}, {0xff, 0xee, 0x11}, {0xff, 0x00, 0xff}},
+    /* 38 */
+    {{0xff, 0x8c, 0x73}, {0xff, 0x66, 0x99}, {0xff, 0xa6, 0x59}, {0xff, 0x48, 0xb7},
+     {0xff, 0x55, 0xaa}, {0xff, 0xbb, 0x44}, {0xff, 0x37, 0xc8}, {0xff, 0xd9, 0x26},
+     {0xff, 0xcc, 0x33}, {0xff, 0x22, 0xdd}, {0xff, 0xea, 0x15}, {0xff, 0x04, 0xfb}},
+    /* 39 */
+    {{0xff, 0x88, 0x77}, {0xff, 0x6a, 0x95}, {0xff, 0xa2, 0x5d}, {0xff, 0x4c, 0xb3},
+     {0xff, 0x59, 0xa6}, {0xff, 0xb7, 0x48}, {0xff, 0x3b, 0xc4}, {0xff, 0xd5, 0x2a},
+     {0xff, 0xc8, 0x37}, {0xff, 0x26, 0xd9}, {0xff, 0xe6, 0x19}, {0xff, 0x08, 0xf7}},
+    /* 40 */
+    {{0xff, 0x84, 0x7b}, {0xff, 0x6e, 0x91}, {0xff, 0x9d, 0x62}, {0xff, 0x51, 0xae},
+     {0xff, 0x5d, 0xa2}, {0xff, 0xb3, 0x4c}, {0xff, 0x40, 0xbf}, {0xff, 0xd1, 0x2e},
+     {0xff, 0xc4, 0x3b}, {0xff, 0x2a, 0xd5}, {0xff, 0xe2, 0x1d}, {0xff, 0x0c, 0xf3}},
+    /* 41 */
+    {{0xff, 0x7b, 0x84}, {0xff, 0x77, 0x88}, {0xff, 0x95, 0x6a}, {0xff, 0x59, 0xa6},
+     {0xff, 0x66, 0x99}, {0xff, 0xaa, 0x55}, {0xff, 0x48, 0xb7}, {0xff, 0xc8, 0x37},
+     {0xff, 0xbb, 0x44}, {0xff, 0x33, 0xcc}, {0xff, 0xd9, 0x26}, {0xff, 0x15, 0xea}},
+    /* 42 */
+    {{0xff, 0x77, 0x88}, {0xff, 0x7b, 0x84}, {0xff, 0x91, 0x6e}, {0xff, 0x5d, 0xa2},
+     {0xff, 0x6a, 0x95}, {0xff, 0xa6, 0x59}, {0xff, 0x4c, 0xb3}, {0xff, 0xc4, 0x3b},
+     {0xff, 0xb7, 0x48}, {0xff, 0x37, 0xc8}, {0xff, 0xd5, 0x2a}, {0xff, 0x19, 0xe6}},
+    /* 43 */
+    {{0xff, 0x73, 0x8c}, {0xff, 0x80, 0x7f}, {0xff, 0x8c, 0x73}, {0xff, 0x62, 0x9d},
+     {0xff, 0x6e, 0x91}, {0xff, 0xa2, 0x5d}, {0xff, 0x51, 0xae}, {0xff, 0xbf, 0x40},
+     {0xff, 0xb3, 0x4c}, {0xff, 0x3b, 0xc4}, {0xff, 0xd1, 0x2e}, {0xff, 0x1d, 0xe2}},
+    /* 44 */
+    {{0xff, 0x6e, 0x91}, {0xff, 0x84, 0x7b}, {0xff, 0x88, 0x77}, {0xff, 0x66, 0x99},
+     {0xff, 0x73, 0x8c}, {0xff, 0x9d, 0x62}, {0xff, 0x55, 0xaa}, {0xff, 0xbb, 0x44},
+     {0xff, 0xae, 0x51}, {0xff, 0x40, 0xbf}, {0xff, 0xcc, 0x33}, {0xff, 0x22, 0xdd}},
+    /* 45 */
+    {{0xff, 0x6a, 0x95}, {0xff, 0x88, 0x77}, {0xff, 0x84, 0x7b}, {0xff, 0x6a, 0x95},
+     {0xff, 0x77, 0x88}, {0xff, 0x99, 0x66}, {0xff, 0x59, 0xa6}, {0xff, 0xb7, 0x48},
+     {0xff, 0xaa, 0x55}, {0xff, 0x44, 0xbb}, {0xff, 0xc8, 0x37}, {0xff, 0x26, 0xd9}},
+    /* 46 */
+    {{0xff, 0x62, 0x9d}, {0xff, 0x91, 0x6e}, {0xff, 0x7b, 0x84}, {0xff, 0x73, 0x8c},
+     {0xff, 0x80, 0x7f}, {0xff, 0x91, 0x6e}, {0xff, 0x62, 0x9d}, {0xff, 0xae, 0x51},
+     {0xff, 0xa2, 0x5d}, {0xff, 0x4c, 0xb3}, {0xff, 0xbf, 0x40}, {0xff, 0x2e, 0xd1}},
+    /* 47 */
+    {{0xff, 0x5d, 0xa2}, {0xff, 0x95, 0x6a}, {0xff, 0x77, 0x88}, {0xff, 0x77, 0x88},
+     {0xff, 0x84, 0x7b}, {0xff, 0x8c, 0x73}, {0xff, 0x66, 0x99}, {0xff, 0xaa, 0x55},
+     {0xff, 0x9d, 0x62}, {0xff, 0x51, 0xae}, {0xff, 0xbb, 0x44}, {0xff, 0x33, 0xcc}},
+    /* 48 */
+    {{0xff, 0x59, 0xa6}, {0xff, 0x99, 0x66}, {0xff, 0x73, 0x8c}, {0xff, 0x7b, 0x84},
+     {0xff, 0x88, 0x77}, {0xff, 0x88, 0x77}, {0xff, 0x6a, 0x95}, {0xff, 0xa6, 0x59},
+     {0xff, 0x99, 0x66}, {0xff, 0x55, 0xaa}, {0xff, 0xb7, 0x48}, {0xff, 0x37, 0xc8}},
+    /* 49 */
+    {{0xff, 0x55, 0xaa}, {0xff, 0x9d, 0x62}, {0xff, 0x6e, 0x91}, {0xff, 0x80, 0x7f},
+     {0xff, 0x8c, 0x73}, {0xff, 0x84, 0x7b}, {0xff, 0x6e, 0x91}, {0xff, 0xa2, 0x5d},
+     {0xff, 0x95, 0x6a}, {0xff, 0x59, 0xa6}, {0xff, 0xb3, 0x4c}, {0xff, 0x3b, 0xc4}},
+    /* 50 */
+    {{0xff, 0x51, 0xae}, {0xff, 0xa2, 0x5d}, {0xff, 0x6a, 0x95}, {0xff, 0x84, 0x7b},
+     {0xff, 0x91, 0x6e}, {0xff, 0x7f, 0x80}, {0xff, 0x73, 0x8c}, {0xff, 0x9d, 0x62},
+     {0xff, 0x91, 0x6e}, {0xff, 0x5d, 0xa2}, {0xff, 0xae, 0x51}, {0xff, 0x40, 0xbf}},
+    /* 51 */
+    {{0xff, 0x48, 0xb7}, {0xff, 0xaa, 0x55}, {0xff, 0x62, 0x9d}, {0xff, 0x8c, 0x73},
+     {0xff, 0x99, 0x66}, {0xff, 0x77, 0x88}, {0xff, 0x7b, 0x84}, {0xff, 0x95, 0x6a},
+     {0xff, 0x88, 0x77}, {0xff, 0x66, 0x99}, {0xff, 0xa6, 0x59}, {0xff, 0x48, 0xb7}},
+    /* 52 */
+    {{0xff, 0x44, 0xbb}, {0xff, 0xae, 0x51}, {0xff, 0x5d, 0xa2}, {0xff, 0x91, 0x6e},
+     {0xff, 0x9d, 0x62}, {0xff, 0x73, 0x8c}, {0xff, 0x80, 0x7f}, {0xff, 0x91, 0x6e},
+     {0xff, 0x84, 0x7b}, {0xff, 0x6a, 0x95}, {0xff, 0xa2, 0x5d}, {0xff, 0x4c, 0xb3}},
+    /* 53 */
+    {{0xff, 0x3f, 0xc0}, {0xff, 0xb3, 0x4c}, {0xff, 0x59, 0xa6}, {0xff, 0x95, 0x6a},
+     {0xff, 0xa2, 0x5d}, {0xff, 0x6e, 0x91}, {0xff, 0x84, 0x7b}, {0xff, 0x8c, 0x73},
+     {0xff, 0x7f, 0x80}, {0xff, 0x6e, 0x91}, {0xff, 0x9d, 0x62}, {0xff, 0x51, 0xae}},
+    /* 54 */
+    {{0xff, 0x3b, 0xc4}, {0xff, 0xb7, 0x48}, {0xff, 0x55, 0xaa}, {0xff, 0x99, 0x66},
+     {0xff, 0xa6, 0x59}, {0xff, 0x6a, 0x95}, {0xff, 0x88, 0x77}, {0xff, 0x88, 0x77},
+     {0xff, 0x7b, 0x84}, {0xff, 0x73, 0x8c}, {0xff, 0x99, 0x66}, {0xff, 0x55, 0xaa}},
+    /* 55 */
+    {{0xff, 0x37, 0xc8}, {0xff, 0xbb, 0x44}, {0xff, 0x51, 0xae}, {0xff, 0x9d, 0x62},
+     {0xff, 0xaa, 0x55}, {0xff, 0x66, 0x99}, {0xff, 0x8c, 0x73}, {0xff, 0x84, 0x7b},
+     {0xff, 0x77, 0x88}, {0xff, 0x77, 0x88}, {0xff, 0x95, 0x6a}, {0xff, 0x59, 0xa6}},
+    /* 56 */
+    {{0xff, 0x2e, 0xd1}, {0xff, 0xc4, 0x3b}, {0xff, 0x48, 0xb7}, {0xff, 0xa6, 0x59},
+     {0xff, 0xb3, 0x4c}, {0xff, 0x5d, 0xa2}, {0xff, 0x95, 0x6a}, {0xff, 0x7b, 0x84},
+     {0xff, 0x6e, 0x91}, {0xff, 0x80, 0x7f}, {0xff, 0x8c, 0x73}, {0xff, 0x62, 0x9d}},
+    /* 57 */
+    {{0xff, 0x2a, 0xd5}, {0xff, 0xc8, 0x37}, {0xff, 0x44, 0xbb}, {0xff, 0xaa, 0x55},
+     {0xff, 0xb7, 0x48}, {0xff, 0x59, 0xa6}, {0xff, 0x99, 0x66}, {0xff, 0x77, 0x88},
+     {0xff, 0x6a, 0x95}, {0xff, 0x84, 0x7b}, {0xff, 0x88, 0x77}, {0xff, 0x66, 0x99}},
+    /* 58 */
+    {{0xff, 0x26, 0xd9}, {0xff, 0xcc, 0x33}, {0xff, 0x3f, 0xc0}, {0xff, 0xae, 0x51},
+     {0xff, 0xbb, 0x44}, {0xff, 0x55, 0xaa}, {0xff, 0x9d, 0x62}, {0xff, 0x73, 0x8c},
+     {0xff, 0x66, 0x99}, {0xff, 0x88, 0x77}, {0xff, 0x84, 0x7b}, {0xff, 0x6a, 0x95}},
+    /* 59 */
+    {{0xff, 0x22, 0xdd}, {0xff, 0xd1, 0x2e}, {0xff, 0x3b, 0xc4}, {0xff, 0xb3, 0x4c},
+     {0xff, 0xc0, 0x3f}, {0xff, 0x51, 0xae}, {0xff, 0xa2, 0x5d}, {0xff, 0x6e, 0x91},
+     {0xff, 0x62, 0x9d}, {0xff, 0x8c, 0x73}, {0xff, 0x7f, 0x80}, {0xff, 0x6e, 0x91}},
+    /* 60 */
+    {{0xff, 0x1d, 0xe2}, {0xff, 0xd5, 0x2a}, {0xff, 0x37, 0xc8}, {0xff, 0xb7, 0x48},
+     {0xff, 0xc4, 0x3b}, {0xff, 0x4c, 0xb3}, {0xff, 0xa6, 0x59}, {0xff, 0x6a, 0x95},
+     {0xff, 0x5d, 0xa2}, {0xff, 0x91, 0x6e}, {0xff, 0x7b, 0x84}, {0xff, 0x73, 0x8c}},
+    /* 61 */
+    {{0xff, 0x15, 0xea}, {0xff, 0xdd, 0x22}, {0xff, 0x2e, 0xd1}, {0xff, 0xc0, 0x3f},
+     {0xff, 0xcc, 0x33}, {0xff, 0x44, 0xbb}, {0xff, 0xae, 0x51}, {0xff, 0x62, 0x9d},
+     {0xff, 0x55, 0xaa}, {0xff, 0x99, 0x66}, {0xff, 0x73, 0x8c}, {0xff, 0x7b, 0x84}},
+    /* 62 */
+    {{0xff, 0x11, 0xee}, {0xff, 0xe2, 0x1d}, {0xff, 0x2a, 0xd5}, {0xff, 0xc4, 0x3b},
+     {0xff, 0xd1, 0x2e}, {0xff, 0x3f, 0xc0}, {0xff, 0xb3, 0x4c}, {0xff, 0x5d, 0xa2},
+     {0xff, 0x51, 0xae}, {0xff, 0x9d, 0x62}, {0xff, 0x6e, 0x91}, {0xff, 0x80, 0x7f}},
+    /* 63 */
+    {{0xff, 0x0c, 0xf3}, {0xff, 0xe6, 0x19}, {0xff, 0x26, 0xd9}, {0xff, 0xc8, 0x37},
+     {0xff, 0xd5, 0x2a}, {0xff, 0x3b, 0xc4}, {0xff, 0xb7, 0x48}, {0xff, 0x59, 0xa6},
+     {0xff, 0x4c, 0xb3}, {0xff, 0xa2, 0x5d}, {0xff, 0x6a, 0x95}, {0xff, 0x84, 0x7b}},
+    /* 64 */
+    {{0xff, 0x08, 0xf7}, {0xff, 0xea, 0x15}, {0xff, 0x22, 0xdd}, {0xff, 0xcc, 0x33},
+     {0xff, 0xd9, 0x26}, {0xff, 0x37, 0xc8}, {0xff, 0xbb, 0x44}, {0xff, 0x55, 0xaa},
+     {0xff, 0x48, 0xb7}, {0xff, 0xa6, 0x59}, {0xff, 0x66, 0x99}, {0xff, 0x88, 0x77}},
+    /* 65 */
+    {{0xff, 0x04, 0xfb}, {0xff, 0xee, 0x11}, {0xff, 0x1d, 0xe2}, {0xff, 0xd1, 0x2e},
+     {0xff, 0xdd, 0x22}, {0xff, 0x33, 0xcc}, {0xff, 0xc0, 0x3f}, {0xff, 0x51, 0xae},
+     {0xff, 0x44, 0xbb}, {0xff, 0xaa, 0x55}, {0xff, 0x62, 0x9d}, {0xff, 0x8c, 0x73}},
+    /* 66 */
+    {{0xff, 0x04, 0xfb}, {0xff, 0xf7, 0x08}, {0xff, 0x15, 0xea}, {0xff, 0xd9, 0x26},
+     {0xff, 0xe6, 0x19}, {0xff, 0x2a, 0xd5}, {0xff, 0xc8, 0x37}, {0xff, 0x48, 0xb7},
+     {0xff, 0x3b, 0xc4}, {0xff, 0xb3, 0x4c}, {0xff, 0x59, 0xa6}, {0xff, 0x95, 0x6a}},
+    /* 67 */
+    {{0xff, 0x08, 0xf7}, {0xff, 0xfb, 0x04}, {0xff, 0x11, 0xee}, {0xff, 0xdd, 0x22},
+     {0xff, 0xea, 0x15}, {0xff, 0x26, 0xd9}, {0xff, 0xcc, 0x33}, {0xff, 0x44, 0xbb},
+     {0xff, 0x37, 0xc8}, {0xff, 0xb7, 0x48}, {0xff, 0x55, 0xaa}, {0xff, 0x99, 0x66}},
+    /* 68 */
+    {{0xff, 0x0c, 0xf3}, {0xff, 0xff, 0x00}, {0xff, 0x0c, 0xf3}, {0xff, 0xe2, 0x1d},
+     {0xff, 0xee, 0x11}, {0xff, 0x22, 0xdd}, {0xff, 0xd1, 0x2e}, {0xff, 0x3f, 0xc0},
+     {0xff, 0x33, 0xcc}, {0xff, 0xbb, 0x44}, {0xff, 0x51, 0xae}, {0xff, 0x9d, 0x62}},
+    /* 69 */
+    {{0xff, 0x11, 0xee}, {0xff, 0xfb, 0x04}, {0xff, 0x08, 0xf7}, {0xff, 0xe6, 0x19},
+     {0xff, 0xf3, 0x0c}, {0xff, 0x1d, 0xe2}, {0xff, 0xd5, 0x2a}, {0xff, 0x3b, 0xc4},
+     {0xff, 0x2e, 0xd1}, {0xff, 0xc0, 0x3f}, {0xff, 0x4c, 0xb3}, {0xff, 0xa2, 0x5d}},
+    /* 70 */
+    {{0xff, 0x15, 0xea}, {0xff, 0xf7, 0x08}, {0xff, 0x04, 0xfb}, {0xff, 0xea, 0x15},
+     {0xff, 0xf7, 0x08}, {0xff, 0x19, 0xe6}, {0xff, 0xd9, 0x26}, {0xff, 0x37, 0xc8},
+     {0xff, 0x2a, 0xd5}, {0xff, 0xc4, 0x3b}, {0xff, 0x48, 0xb7}, {0xff, 0xa6, 0x59}},
+    /* 71 */
+    {{0xff, 0x1d, 0xe2}, {0xff, 0xee, 0x11}, {0xff, 0x04, 0xfb}, {0xff, 0xf3, 0x0c},
+     {0xff, 0xff, 0x00}, {0xff, 0x11, 0xee}, {0xff, 0xe2, 0x1d}, {0xff, 0x2e, 0xd1},
+     {0xff, 0x22, 0xdd}, {0xff, 0xcc, 0x33}, {0xff, 0x3f, 0xc0}, {0xff, 0xae, 0x51}},
+    /* 72 */
+    {{0xff, 0x22, 0xdd}, {0xff, 0xea, 0x15}, {0xff, 0x08, 0xf7}, {0xff, 0xf7, 0x08},
+     {0xff, 0xfb, 0x04}, {0xff, 0x0c, 0xf3}, {0xff, 0xe6, 0x19}, {0xff, 0x2a, 0xd5},
+     {0xff, 0x1d, 0xe2}, {0xff, 0xd1, 0x2e}, {0xff, 0x3b, 0xc4}, {0xff, 0xb3, 0x4c}},
+    /* 73 */
+    {{0xff, 0x26, 0xd9}, {0xff, 0xe6, 0x19}, {0xff, 0x0c, 0xf3}, {0xff, 0xfb, 0x04},
+     {0xff, 0xf7, 0x08}, {0xff, 0x08, 0xf7}, {0xff, 0xea, 0x15}, {0xff, 0x26, 0xd9},
+     {0xff, 0x19, 0xe6}, {0xff, 0xd5, 0x2a}, {0xff, 0x37, 0xc8}, {0xff, 0xb7, 0x48}},
+    /* 74 */
+    {{0xff, 0x2a, 0xd5}, {0xff, 0xe2, 0x1d}, {0xff, 0x11, 0xee}, {0xff, 0xff, 0x00},
+     {0xff, 0xf3, 0x0c}, {0xff, 0x04, 0xfb}, {0xff, 0xee, 0x11}, {0xff, 0x22, 0xdd},
+     {0xff, 0x15, 0xea}, {0xff, 0xd9, 0x26}, {0xff, 0x33, 0xcc}, {0xff, 0xbb, 0x44}},
+};
@@ -0,0 +1,253 @@
+/*
+ * Copyright (c) 2024 Kuba Birecki
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+/**
+ * Frames of ripple.overlay, recorded with CONFIG_RGB_FX_GOLDEN_RECORD=y.
+ */
+static const uint8_t golden_frames[][RGB_FX_NUM_PIXELS][3] = {
+    /* 0 */
+    {{0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0x00, 0x00, 0x00}, {0x00, 0xff, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}},
+    /* 1 */
+    {{0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0x00, 0x00, 0x00}, {0x00, 0xae, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}},
+    /* 2 */
+    {{0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0x00, 0x00, 0x00}, {0x00, 0x51, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}},
+    /* 3 */
+    {{0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}},
+    /* 4 */
+    {{0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0x00, 0x1e, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x1e, 0x00}, {0x00, 0x00, 0x00},
+     {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}},
+    /* 5 */
+    {{0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0x00, 0x70, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x70, 0x00}, {0x00, 0x00, 0x00},
+     {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}},
+    /* 6 */
+    {{0x00, 0x00, 0x00}, {0x00, 0x51, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0x00, 0xcc, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0xcc, 0x00}, {0x00, 0x00, 0x00},
+     {0x00, 0x00, 0x00}, {0x00, 0x51, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}},
+    /* 7 */
+    {{0x00, 0x00, 0x00}, {0x00, 0xa3, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0x00, 0xe1, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0xe1, 0x00}, {0x00, 0x00, 0x00},
+     {0x00, 0x00, 0x00}, {0x00, 0xa3, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}},
+    /* 8 */
+    {{0x00, 0x33, 0x00}, {0x00, 0xff, 0x00}, {0x00, 0x33, 0x00}, {0x00, 0x00, 0x00},
+     {0x00, 0x85, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x85, 0x00}, {0x00, 0x00, 0x00},
+     {0x00, 0x33, 0x00}, {0x00, 0xff, 0x00}, {0x00, 0x33, 0x00}, {0x00, 0x00, 0x00}},
+    /* 9 */
+    {{0x00, 0x85, 0x00}, {0x00, 0xae, 0x00}, {0x00, 0x85, 0x00}, {0x00, 0x00, 0x00},
+     {0x00, 0x33, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x33, 0x00}, {0x00, 0x00, 0x00},
+     {0x00, 0x85, 0x00}, {0x00, 0xae, 0x00}, {0x00, 0x85, 0x00}, {0x00, 0x00, 0x00}},
+    /* 10 */
+    {{0x00, 0xff, 0x00}, {0x00, 0x51, 0x00}, {0x00, 0xe1, 0x00}, {0x00, 0x00, 0x00},
+     {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0x00, 0xe1, 0x00}, {0x00, 0x51, 0x00}, {0x00, 0xe1, 0x00}, {0x00, 0x00, 0x00}},
+    /* 11 */
+    {{0x00, 0xae, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0xcc, 0x00}, {0x00, 0x00, 0x00},
+     {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x33, 0x00},
+     {0x00, 0xcc, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0xcc, 0x00}, {0x00, 0x00, 0x00}},
+    /* 12 */
+    {{0x00, 0x51, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x70, 0x00}, {0x00, 0x00, 0x00},
+     {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x8f, 0x00},
+     {0x00, 0x70, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x70, 0x00}, {0x00, 0x00, 0x00}},
+    /* 13 */
+    {{0x00, 0x1e, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x1e, 0x00}, {0x00, 0x1e, 0x00},
+     {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0xe1, 0x00},
+     {0x00, 0x1e, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x1e, 0x00}, {0x00, 0x1e, 0x00}},
+    /* 14 */
+    {{0x00, 0x00, 0x00}, {0x00, 0x1e, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x7a, 0x00},
+     {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0xc2, 0x00},
+     {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x7a, 0x00}},
+    /* 15 */
+    {{0x00, 0x00, 0x00}, {0x00, 0x70, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0xcc, 0x00},
+     {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x70, 0x00},
+     {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0xcc, 0x00}},
+    /* 16 */
+    {{0x00, 0x00, 0x00}, {0x00, 0xcc, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0xd7, 0x00},
+     {0x00, 0x51, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x14, 0x00},
+     {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0xd7, 0x00}},
+    /* 17 */
+    {{0x00, 0x00, 0x00}, {0x00, 0xe1, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x85, 0x00},
+     {0x00, 0xa3, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x85, 0x00}},
+    /* 18 */
+    {{0x00, 0x00, 0x00}, {0x00, 0x85, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x28, 0x00},
+     {0x00, 0xff, 0x00}, {0x00, 0x33, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x28, 0x00}},
+    /* 19 */
+    {{0x00, 0x00, 0x00}, {0x00, 0x33, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0x00, 0xae, 0x00}, {0x00, 0x85, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}},
+    /* 20 */
+    {{0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0x00, 0x51, 0x00}, {0x00, 0xe1, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0xff, 0x00}},
+    /* 21 */
+    {{0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x33, 0x00}, {0x00, 0x00, 0x00},
+     {0x00, 0x00, 0x00}, {0x00, 0xcc, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0xae, 0x00}},
+    /* 22 */
+    {{0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x8f, 0x00}, {0x00, 0x00, 0x00},
+     {0x00, 0x00, 0x00}, {0x00, 0x70, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x51, 0x00}},
+    /* 23 */
+    {{0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0xe1, 0x00}, {0x00, 0x00, 0x00},
+     {0x00, 0x00, 0x00}, {0x00, 0x1e, 0x00}, {0x00, 0x1e, 0x00}, {0x00, 0x00, 0x00},
+     {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}},
+    /* 24 */
+    {{0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0xc2, 0x00}, {0x00, 0x00, 0x00},
+     {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x7a, 0x00}, {0x00, 0x00, 0x00},
+     {0x00, 0x51, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x1e, 0x00}, {0x00, 0x00, 0x00}},
+    /* 25 */
+    {{0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x70, 0x00}, {0x00, 0x00, 0x00},
+     {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0xcc, 0x00}, {0x00, 0x00, 0x00},
+     {0x00, 0xa3, 0x00}, {0x00, 0x33, 0x00}, {0x00, 0x70, 0x00}, {0x00, 0x00, 0x00}},
+    /* 26 */
+    {{0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x14, 0x00}, {0x00, 0x00, 0x00},
+     {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0xd7, 0x00}, {0x00, 0x51, 0x00},
+     {0x00, 0xff, 0x00}, {0x00, 0x8f, 0x00}, {0x00, 0xcc, 0x00}, {0x00, 0x00, 0x00}},
+    /* 27 */
+    {{0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x85, 0x00}, {0x00, 0xa3, 0x00},
+     {0x00, 0xae, 0x00}, {0x00, 0xe1, 0x00}, {0x00, 0xe1, 0x00}, {0x00, 0x00, 0x00}},
+    /* 28 */
+    {{0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x51, 0x00},
+     {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x33, 0x00}, {0x00, 0xff, 0x00},
+     {0x00, 0x51, 0x00}, {0x00, 0xc2, 0x00}, {0x00, 0x85, 0x00}, {0x00, 0x00, 0x00}},
+    /* 29 */
+    {{0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0xa3, 0x00},
+     {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x85, 0x00}, {0x00, 0xae, 0x00},
+     {0x00, 0x00, 0x00}, {0x00, 0x70, 0x00}, {0x00, 0x33, 0x00}, {0x00, 0x00, 0x00}},
+    /* 30 */
+    {{0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0xff, 0x00},
+     {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0xe1, 0x00}, {0x00, 0x51, 0x00},
+     {0x00, 0x00, 0x00}, {0x00, 0x14, 0x00}, {0x00, 0xb8, 0x00}, {0x00, 0x00, 0x00}},
+    /* 31 */
+    {{0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0xae, 0x00},
+     {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0xcc, 0x00}, {0x00, 0xcc, 0x00},
+     {0x00, 0x00, 0x00}, {0x00, 0x33, 0x00}, {0x00, 0xf5, 0x00}, {0x00, 0x00, 0x00}},
+    /* 32 */
+    {{0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x51, 0x00},
+     {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x70, 0x00}, {0x00, 0xd7, 0x00},
+     {0x00, 0x00, 0x00}, {0x00, 0x8f, 0x00}, {0x00, 0x99, 0x00}, {0x00, 0x00, 0x00}},
+    /* 33 */
+    {{0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0x00, 0x00, 0x00}, {0x00, 0x1e, 0x00}, {0x00, 0x1e, 0x00}, {0x00, 0x85, 0x00},
+     {0x00, 0x00, 0x00}, {0x00, 0xe1, 0x00}, {0x00, 0x47, 0x00}, {0x00, 0x1e, 0x00}},
+    /* 34 */
+    {{0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x51, 0x00},
+     {0x00, 0x00, 0x00}, {0x00, 0x7a, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x28, 0x00},
+     {0x00, 0x00, 0x00}, {0x00, 0xc2, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x7a, 0x00}},
+    /* 35 */
+    {{0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x33, 0x00}, {0x00, 0xa3, 0x00},
+     {0x00, 0x00, 0x00}, {0x00, 0xcc, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0x00, 0x00, 0x00}, {0x00, 0x70, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0xcc, 0x00}},
+    /* 36 */
+    {{0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x8f, 0x00}, {0x00, 0xff, 0x00},
+     {0x00, 0x00, 0x00}, {0x00, 0xd7, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0x00, 0x00, 0x00}, {0x00, 0x14, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0xd7, 0x00}},
+    /* 37 */
+    {{0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0xe1, 0x00}, {0x00, 0xae, 0x00},
+     {0x00, 0x00, 0x00}, {0x00, 0x85, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x85, 0x00}},
+    /* 38 */
+    {{0x00, 0x00, 0x00}, {0x00, 0x0a, 0x00}, {0x00, 0xc2, 0x00}, {0x00, 0x51, 0x00},
+     {0x00, 0x00, 0x00}, {0x00, 0x28, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0x00, 0x51, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x28, 0x00}},
+    /* 39 */
+    {{0x00, 0x00, 0x00}, {0x00, 0x5c, 0x00}, {0x00, 0x70, 0x00}, {0x00, 0x00, 0x00},
+     {0x00, 0x1e, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0x00, 0xa3, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}},
+    /* 40 */
+    {{0x00, 0x00, 0x00}, {0x00, 0xb8, 0x00}, {0x00, 0x14, 0x00}, {0x00, 0x00, 0x00},
+     {0x00, 0x7a, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0x00, 0xff, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}},
+    /* 41 */
+    {{0x00, 0x00, 0x00}, {0x00, 0xf5, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0x00, 0xcc, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0x00, 0xae, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}},
+    /* 42 */
+    {{0x00, 0x00, 0x00}, {0x00, 0x99, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0x00, 0xd7, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0x00, 0x51, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}},
+    /* 43 */
+    {{0x00, 0x1e, 0x00}, {0x00, 0x47, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0x00, 0x85, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}},
+    /* 44 */
+    {{0x00, 0x7a, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0x00, 0x28, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}},
+    /* 45 */
+    {{0x00, 0xcc, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}},
+    /* 46 */
+    {{0x00, 0xd7, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}},
+    /* 47 */
+    {{0x00, 0x85, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}},
+    /* 48 */
+    {{0x00, 0x28, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}},
+    /* 49 */
+    {{0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}},
+    /* 50 */
+    {{0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}},
+    /* 51 */
+    {{0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}},
+    /* 52 */
+    {{0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}},
+    /* 53 */
+    {{0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}},
+    /* 54 */
+    {{0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}},
+    /* 55 */
+    {{0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}},
+    /* 56 */
+    {{0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}},
+    /* 57 */
+    {{0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}},
+    /* 58 */
+    {{0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}},
+    /* 59 */
+    {{0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}},
+};
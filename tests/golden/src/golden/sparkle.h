@@ -0,0 +1,413 @@
+/*
+ * Copyright (c) 2024 Kuba Birecki
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+/**
+ * Frames of sparkle.overlay, recorded with CONFIG_RGB_FX_GOLDEN_RECORD=y.
+ */
+static const uint8_t golden_frames[][RGB_FX_NUM_PIXELS][3] = {
+    /* 0 */
+    {{0xe3, 0x00, 0x07}, {0x00, 0x00, 0x00}, {0x74, 0x00, 0x3a}, {0x00, 0x00, 0x00},
+     {0xe6, 0x00, 0x39}, {0xd2, 0x00, 0x03}, {0x8c, 0x00, 0x02}, {0x7c, 0x00, 0x02},
+     {0xab, 0x00, 0x05}, {0xf4, 0x00, 0x20}, {0xf4, 0x00, 0x04}, {0x00, 0x00, 0x00}},
+    /* 1 */
+    {{0xfd, 0x00, 0x08}, {0x1e, 0x00, 0x00}, {0x4b, 0x00, 0x25}, {0x2e, 0x00, 0x03},
+     {0xeb, 0x00, 0x3a}, {0xe2, 0x00, 0x03}, {0xde, 0x00, 0x03}, {0x81, 0x00, 0x02},
+     {0xbf, 0x00, 0x06}, {0xc6, 0x00, 0x1a}, {0xbb, 0x00, 0x03}, {0x52, 0x00, 0x01}},
+    /* 2 */
+    {{0xe8, 0x00, 0x07}, {0x3d, 0x00, 0x01}, {0x22, 0x00, 0x11}, {0x5c, 0x00, 0x07},
+     {0xbd, 0x00, 0x2f}, {0xf1, 0x00, 0x04}, {0xce, 0x00, 0x03}, {0x86, 0x00, 0x02},
+     {0xd3, 0x00, 0x07}, {0x98, 0x00, 0x14}, {0x82, 0x00, 0x02}, {0xa5, 0x00, 0x02}},
+    /* 3 */
+    {{0xcf, 0x00, 0x06}, {0x5c, 0x00, 0x01}, {0x00, 0x00, 0x00}, {0x8a, 0x00, 0x0b},
+     {0x8e, 0x00, 0x23}, {0xff, 0x00, 0x04}, {0x7b, 0x00, 0x02}, {0x8b, 0x00, 0x02},
+     {0xe8, 0x00, 0x07}, {0x6a, 0x00, 0x0e}, {0x49, 0x00, 0x01}, {0xf7, 0x00, 0x04}},
+    /* 4 */
+    {{0xb5, 0x00, 0x06}, {0x7b, 0x00, 0x02}, {0x14, 0x00, 0x01}, {0xb8, 0x00, 0x0f},
+     {0x60, 0x00, 0x18}, {0xef, 0x00, 0x03}, {0x29, 0x00, 0x00}, {0x90, 0x00, 0x02},
+     {0xfc, 0x00, 0x08}, {0x3b, 0x00, 0x07}, {0x11, 0x00, 0x00}, {0xb5, 0x00, 0x03}},
+    /* 5 */
+    {{0x9c, 0x00, 0x05}, {0x9a, 0x00, 0x02}, {0x28, 0x00, 0x02}, {0xe6, 0x00, 0x13},
+     {0x32, 0x00, 0x0c}, {0xe0, 0x00, 0x03}, {0x00, 0x00, 0x00}, {0x96, 0x00, 0x02},
+     {0xee, 0x00, 0x07}, {0x0d, 0x00, 0x01}, {0x00, 0x00, 0x00}, {0x63, 0x00, 0x01}},
+    /* 6 */
+    {{0x82, 0x00, 0x04}, {0xb9, 0x00, 0x03}, {0x3d, 0x00, 0x04}, {0xeb, 0x00, 0x13},
+     {0x04, 0x00, 0x01}, {0xd1, 0x00, 0x03}, {0x52, 0x00, 0x04}, {0x9b, 0x00, 0x02},
+     {0xda, 0x00, 0x07}, {0x00, 0x00, 0x00}, {0x1e, 0x00, 0x06}, {0x10, 0x00, 0x00}},
+    /* 7 */
+    {{0x68, 0x00, 0x03}, {0xd7, 0x00, 0x03}, {0x51, 0x00, 0x05}, {0xbd, 0x00, 0x0f},
+     {0x00, 0x00, 0x00}, {0xc1, 0x00, 0x03}, {0xa5, 0x00, 0x08}, {0xa0, 0x00, 0x02},
+     {0xc5, 0x00, 0x06}, {0x38, 0x00, 0x00}, {0x3d, 0x00, 0x0d}, {0x00, 0x00, 0x00}},
+    /* 8 */
+    {{0x4f, 0x00, 0x02}, {0xf6, 0x00, 0x04}, {0x66, 0x00, 0x06}, {0x8e, 0x00, 0x0b},
+     {0x00, 0x00, 0x1e}, {0xb2, 0x00, 0x02}, {0xf7, 0x00, 0x0c}, {0xa5, 0x00, 0x02},
+     {0xb1, 0x00, 0x05}, {0x71, 0x00, 0x01}, {0x5c, 0x00, 0x14}, {0x48, 0x00, 0x01}},
+    /* 9 */
+    {{0x35, 0x00, 0x01}, {0xea, 0x00, 0x03}, {0x7a, 0x00, 0x08}, {0x60, 0x00, 0x08},
+     {0x00, 0x00, 0x3d}, {0xa2, 0x00, 0x02}, {0xb5, 0x00, 0x09}, {0xaa, 0x00, 0x02},
+     {0x9c, 0x00, 0x05}, {0xaa, 0x00, 0x02}, {0x7b, 0x00, 0x1a}, {0x90, 0x00, 0x02}},
+    /* 10 */
+    {{0x1c, 0x00, 0x00}, {0xcb, 0x00, 0x03}, {0x8f, 0x00, 0x09}, {0x32, 0x00, 0x04},
+     {0x00, 0x00, 0x5c}, {0x93, 0x00, 0x02}, {0x63, 0x00, 0x04}, {0xaf, 0x00, 0x02},
+     {0x88, 0x00, 0x04}, {0xe3, 0x00, 0x03}, {0x9a, 0x00, 0x21}, {0xd8, 0x00, 0x03}},
+    /* 11 */
+    {{0x02, 0x00, 0x00}, {0xac, 0x00, 0x02}, {0xa3, 0x00, 0x0a}, {0x04, 0x00, 0x00},
+     {0x00, 0x00, 0x7b}, {0x84, 0x00, 0x02}, {0x10, 0x00, 0x00}, {0xb4, 0x00, 0x03},
+     {0x73, 0x00, 0x03}, {0xe3, 0x00, 0x03}, {0xb9, 0x00, 0x28}, {0xdf, 0x00, 0x03}},
+    /* 12 */
+    {{0x00, 0x00, 0x00}, {0x8d, 0x00, 0x02}, {0xb8, 0x00, 0x0c}, {0x00, 0x00, 0x00},
+     {0x00, 0x00, 0x9a}, {0x74, 0x00, 0x01}, {0x00, 0x00, 0x00}, {0xb9, 0x00, 0x03},
+     {0x5f, 0x00, 0x03}, {0xaa, 0x00, 0x02}, {0xd7, 0x00, 0x2e}, {0x97, 0x00, 0x02}},
+    /* 13 */
+    {{0x28, 0x00, 0x01}, {0x6f, 0x00, 0x01}, {0xcc, 0x00, 0x0d}, {0x24, 0x00, 0x00},
+     {0x00, 0x00, 0xb9}, {0x65, 0x00, 0x01}, {0x05, 0x00, 0x00}, {0xbe, 0x00, 0x03},
+     {0x4a, 0x00, 0x02}, {0x71, 0x00, 0x01}, {0xf6, 0x00, 0x35}, {0x4f, 0x00, 0x01}},
+    /* 14 */
+    {{0x51, 0x00, 0x02}, {0x50, 0x00, 0x01}, {0xe1, 0x00, 0x0f}, {0x48, 0x00, 0x01},
+     {0x00, 0x00, 0xd7}, {0x56, 0x00, 0x01}, {0x0a, 0x00, 0x00}, {0xc4, 0x00, 0x03},
+     {0x36, 0x00, 0x01}, {0x38, 0x00, 0x00}, {0xea, 0x00, 0x32}, {0x07, 0x00, 0x00}},
+    /* 15 */
+    {{0x7a, 0x00, 0x04}, {0x31, 0x00, 0x00}, {0xf5, 0x00, 0x10}, {0x6c, 0x00, 0x01},
+     {0x00, 0x00, 0xf6}, {0x46, 0x00, 0x01}, {0x0f, 0x00, 0x00}, {0xc9, 0x00, 0x03},
+     {0x21, 0x00, 0x01}, {0x00, 0x00, 0x00}, {0xcb, 0x00, 0x2c}, {0x00, 0x00, 0x00}},
+    /* 16 */
+    {{0xa3, 0x00, 0x05}, {0x12, 0x00, 0x00}, {0xf5, 0x00, 0x10}, {0x90, 0x00, 0x02},
+     {0x00, 0x00, 0xea}, {0x37, 0x00, 0x00}, {0x14, 0x00, 0x00}, {0xce, 0x00, 0x03},
+     {0x0d, 0x00, 0x00}, {0x19, 0x00, 0x00}, {0xac, 0x00, 0x25}, {0x52, 0x00, 0x0d}},
+    /* 17 */
+    {{0xcc, 0x00, 0x06}, {0x00, 0x00, 0x00}, {0xe1, 0x00, 0x0f}, {0xb4, 0x00, 0x03},
+     {0x00, 0x00, 0xcb}, {0x27, 0x00, 0x00}, {0x19, 0x00, 0x00}, {0xd3, 0x00, 0x03},
+     {0x00, 0x00, 0x00}, {0x33, 0x00, 0x00}, {0x8d, 0x00, 0x1e}, {0xa5, 0x00, 0x1b}},
+    /* 18 */
+    {{0xf5, 0x00, 0x08}, {0x1e, 0x00, 0x01}, {0xcc, 0x00, 0x0d}, {0xd8, 0x00, 0x03},
+     {0x00, 0x00, 0xac}, {0x18, 0x00, 0x00}, {0x1e, 0x00, 0x01}, {0xd8, 0x00, 0x03},
+     {0x14, 0x00, 0x00}, {0x4c, 0x00, 0x01}, {0x6f, 0x00, 0x18}, {0xf7, 0x00, 0x29}},
+    /* 19 */
+    {{0xe1, 0x00, 0x07}, {0x3d, 0x00, 0x03}, {0xb8, 0x00, 0x0c}, {0xfc, 0x00, 0x04},
+     {0x00, 0x00, 0x8d}, {0x09, 0x00, 0x00}, {0x23, 0x00, 0x01}, {0xdd, 0x00, 0x03},
+     {0x28, 0x00, 0x00}, {0x66, 0x00, 0x01}, {0x50, 0x00, 0x11}, {0xb5, 0x00, 0x1e}},
+    /* 20 */
+    {{0xb8, 0x00, 0x06}, {0x5c, 0x00, 0x04}, {0xa3, 0x00, 0x0a}, {0xdf, 0x00, 0x03},
+     {0x00, 0x00, 0x6f}, {0x00, 0x00, 0x00}, {0x28, 0x00, 0x01}, {0xe2, 0x00, 0x03},
+     {0x3d, 0x00, 0x01}, {0x7f, 0x00, 0x02}, {0x31, 0x00, 0x0a}, {0x63, 0x00, 0x10}},
+    /* 21 */
+    {{0x8f, 0x00, 0x04}, {0x7b, 0x00, 0x06}, {0x8f, 0x00, 0x09}, {0xbb, 0x00, 0x03},
+     {0x00, 0x00, 0x50}, {0x33, 0x00, 0x03}, {0x2e, 0x00, 0x01}, {0xe7, 0x00, 0x03},
+     {0x51, 0x00, 0x01}, {0x99, 0x00, 0x02}, {0x12, 0x00, 0x04}, {0x10, 0x00, 0x02}},
+    /* 22 */
+    {{0x66, 0x00, 0x03}, {0x9a, 0x00, 0x07}, {0x7a, 0x00, 0x08}, {0x97, 0x00, 0x02},
+     {0x00, 0x00, 0x31}, {0x66, 0x00, 0x06}, {0x33, 0x00, 0x01}, {0xed, 0x00, 0x03},
+     {0x66, 0x00, 0x01}, {0xb3, 0x00, 0x02}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}},
+    /* 23 */
+    {{0x3d, 0x00, 0x02}, {0xb9, 0x00, 0x09}, {0x66, 0x00, 0x06}, {0x73, 0x00, 0x01},
+     {0x00, 0x00, 0x12}, {0x99, 0x00, 0x0a}, {0x38, 0x00, 0x01}, {0xf2, 0x00, 0x04},
+     {0x7a, 0x00, 0x02}, {0xcc, 0x00, 0x03}, {0x28, 0x00, 0x01}, {0x19, 0x00, 0x00}},
+    /* 24 */
+    {{0x14, 0x00, 0x00}, {0xd7, 0x00, 0x0a}, {0x51, 0x00, 0x05}, {0x4f, 0x00, 0x01},
+     {0x00, 0x00, 0x00}, {0xcc, 0x00, 0x0d}, {0x3d, 0x00, 0x02}, {0xf7, 0x00, 0x04},
+     {0x8f, 0x00, 0x02}, {0xe6, 0x00, 0x03}, {0x51, 0x00, 0x02}, {0x33, 0x00, 0x00}},
+    /* 25 */
+    {{0x00, 0x00, 0x00}, {0xf6, 0x00, 0x0c}, {0x3d, 0x00, 0x04}, {0x2b, 0x00, 0x00},
+     {0x2e, 0x00, 0x01}, {0xff, 0x00, 0x11}, {0x42, 0x00, 0x02}, {0xfc, 0x00, 0x04},
+     {0xa3, 0x00, 0x02}, {0xff, 0x00, 0x04}, {0x7a, 0x00, 0x04}, {0x4c, 0x00, 0x01}},
+    /* 26 */
+    {{0x48, 0x00, 0x01}, {0xea, 0x00, 0x0b}, {0x28, 0x00, 0x02}, {0x07, 0x00, 0x00},
+     {0x5c, 0x00, 0x03}, {0xcc, 0x00, 0x0d}, {0x47, 0x00, 0x02}, {0xfe, 0x00, 0x04},
+     {0xb8, 0x00, 0x03}, {0xe6, 0x00, 0x03}, {0xa3, 0x00, 0x05}, {0x66, 0x00, 0x01}},
+    /* 27 */
+    {{0x90, 0x00, 0x02}, {0xcb, 0x00, 0x0a}, {0x14, 0x00, 0x01}, {0x00, 0x00, 0x00},
+     {0x8a, 0x00, 0x04}, {0x99, 0x00, 0x0a}, {0x4c, 0x00, 0x02}, {0xf9, 0x00, 0x04},
+     {0xcc, 0x00, 0x03}, {0xcc, 0x00, 0x03}, {0xcc, 0x00, 0x06}, {0x7f, 0x00, 0x02}},
+    /* 28 */
+    {{0xd8, 0x00, 0x03}, {0xac, 0x00, 0x08}, {0x00, 0x00, 0x00}, {0x24, 0x00, 0x01},
+     {0xb8, 0x00, 0x06}, {0x66, 0x00, 0x06}, {0x51, 0x00, 0x02}, {0xf4, 0x00, 0x04},
+     {0xe1, 0x00, 0x03}, {0xb3, 0x00, 0x02}, {0xf5, 0x00, 0x08}, {0x99, 0x00, 0x02}},
+    /* 29 */
+    {{0xdf, 0x00, 0x03}, {0x8d, 0x00, 0x07}, {0x14, 0x00, 0x02}, {0x48, 0x00, 0x02},
+     {0xe6, 0x00, 0x07}, {0x33, 0x00, 0x03}, {0x57, 0x00, 0x02}, {0xef, 0x00, 0x03},
+     {0xf5, 0x00, 0x04}, {0x99, 0x00, 0x02}, {0xe1, 0x00, 0x07}, {0xb3, 0x00, 0x02}},
+    /* 30 */
+    {{0x97, 0x00, 0x02}, {0x6f, 0x00, 0x05}, {0x28, 0x00, 0x04}, {0x6c, 0x00, 0x03},
+     {0xeb, 0x00, 0x07}, {0x00, 0x00, 0x00}, {0x5c, 0x00, 0x03}, {0xe9, 0x00, 0x03},
+     {0xf5, 0x00, 0x04}, {0x7f, 0x00, 0x02}, {0xb8, 0x00, 0x06}, {0xcc, 0x00, 0x03}},
+    /* 31 */
+    {{0x4f, 0x00, 0x01}, {0x50, 0x00, 0x04}, {0x3d, 0x00, 0x07}, {0x90, 0x00, 0x04},
+     {0xbd, 0x00, 0x06}, {0x24, 0x00, 0x00}, {0x61, 0x00, 0x03}, {0xe4, 0x00, 0x03},
+     {0xe1, 0x00, 0x03}, {0x66, 0x00, 0x01}, {0x8f, 0x00, 0x04}, {0xe6, 0x00, 0x03}},
+    /* 32 */
+    {{0x07, 0x00, 0x00}, {0x31, 0x00, 0x02}, {0x51, 0x00, 0x09}, {0xb4, 0x00, 0x06},
+     {0x8e, 0x00, 0x04}, {0x48, 0x00, 0x01}, {0x66, 0x00, 0x03}, {0xdf, 0x00, 0x03},
+     {0xcc, 0x00, 0x03}, {0x4c, 0x00, 0x01}, {0x66, 0x00, 0x03}, {0xff, 0x00, 0x04}},
+    /* 33 */
+    {{0x00, 0x00, 0x00}, {0x12, 0x00, 0x00}, {0x66, 0x00, 0x0b}, {0xd8, 0x00, 0x07},
+     {0x60, 0x00, 0x03}, {0x6c, 0x00, 0x01}, {0x6b, 0x00, 0x03}, {0xda, 0x00, 0x03},
+     {0xb8, 0x00, 0x03}, {0x33, 0x00, 0x00}, {0x3d, 0x00, 0x02}, {0xe6, 0x00, 0x03}},
+    /* 34 */
+    {{0x4d, 0x00, 0x01}, {0x00, 0x00, 0x00}, {0x7a, 0x00, 0x0e}, {0xfc, 0x00, 0x08},
+     {0x32, 0x00, 0x01}, {0x90, 0x00, 0x02}, {0x70, 0x00, 0x03}, {0xd5, 0x00, 0x03},
+     {0xa3, 0x00, 0x02}, {0x19, 0x00, 0x00}, {0x14, 0x00, 0x00}, {0xcc, 0x00, 0x03}},
+    /* 35 */
+    {{0x9b, 0x00, 0x02}, {0x28, 0x00, 0x00}, {0x8f, 0x00, 0x10}, {0xdf, 0x00, 0x07},
+     {0x04, 0x00, 0x00}, {0xb4, 0x00, 0x03}, {0x75, 0x00, 0x03}, {0xd0, 0x00, 0x03},
+     {0x8f, 0x00, 0x02}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0xb3, 0x00, 0x02}},
+    /* 36 */
+    {{0xe8, 0x00, 0x03}, {0x51, 0x00, 0x01}, {0xa3, 0x00, 0x13}, {0xbb, 0x00, 0x06},
+     {0x00, 0x00, 0x00}, {0xd8, 0x00, 0x03}, {0x7a, 0x00, 0x04}, {0xcb, 0x00, 0x03},
+     {0x7a, 0x00, 0x02}, {0x52, 0x00, 0x02}, {0x52, 0x00, 0x10}, {0x99, 0x00, 0x02}},
+    /* 37 */
+    {{0xc9, 0x00, 0x03}, {0x7a, 0x00, 0x02}, {0xb8, 0x00, 0x15}, {0x97, 0x00, 0x05},
+     {0x3d, 0x00, 0x01}, {0xfc, 0x00, 0x04}, {0x7f, 0x00, 0x04}, {0xc6, 0x00, 0x03},
+     {0x66, 0x00, 0x01}, {0xa5, 0x00, 0x05}, {0xa5, 0x00, 0x21}, {0x7f, 0x00, 0x02}},
+    /* 38 */
+    {{0x7c, 0x00, 0x02}, {0xa3, 0x00, 0x02}, {0xcc, 0x00, 0x17}, {0x73, 0x00, 0x03},
+     {0x7b, 0x00, 0x02}, {0xdf, 0x00, 0x03}, {0x85, 0x00, 0x04}, {0xc1, 0x00, 0x03},
+     {0x51, 0x00, 0x01}, {0xf7, 0x00, 0x08}, {0xf7, 0x00, 0x31}, {0x66, 0x00, 0x01}},
+    /* 39 */
+    {{0x2e, 0x00, 0x00}, {0xcc, 0x00, 0x03}, {0xe1, 0x00, 0x1a}, {0x4f, 0x00, 0x02},
+     {0xb9, 0x00, 0x03}, {0xbb, 0x00, 0x03}, {0x8a, 0x00, 0x04}, {0xbb, 0x00, 0x03},
+     {0x3d, 0x00, 0x01}, {0xb5, 0x00, 0x06}, {0xb5, 0x00, 0x24}, {0x4c, 0x00, 0x01}},
+    /* 40 */
+    {{0x00, 0x00, 0x00}, {0xf5, 0x00, 0x04}, {0xf5, 0x00, 0x1c}, {0x2b, 0x00, 0x01},
+     {0xf6, 0x00, 0x04}, {0x97, 0x00, 0x02}, {0x8f, 0x00, 0x04}, {0xb6, 0x00, 0x03},
+     {0x28, 0x00, 0x00}, {0x63, 0x00, 0x03}, {0x63, 0x00, 0x13}, {0x33, 0x00, 0x00}},
+    /* 41 */
+    {{0x05, 0x00, 0x00}, {0xe1, 0x00, 0x03}, {0xf5, 0x00, 0x1c}, {0x07, 0x00, 0x00},
+     {0xcb, 0x00, 0x03}, {0x73, 0x00, 0x01}, {0x94, 0x00, 0x04}, {0xb1, 0x00, 0x02},
+     {0x14, 0x00, 0x00}, {0x10, 0x00, 0x00}, {0x10, 0x00, 0x03}, {0x19, 0x00, 0x00}},
+    /* 42 */
+    {{0x0a, 0x00, 0x00}, {0xb8, 0x00, 0x03}, {0xe1, 0x00, 0x1a}, {0x00, 0x00, 0x00},
+     {0x8d, 0x00, 0x02}, {0x4f, 0x00, 0x01}, {0x99, 0x00, 0x05}, {0xac, 0x00, 0x02},
+     {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}},
+    /* 43 */
+    {{0x0f, 0x00, 0x01}, {0x8f, 0x00, 0x02}, {0xcc, 0x00, 0x17}, {0x48, 0x00, 0x0c},
+     {0x50, 0x00, 0x01}, {0x2b, 0x00, 0x00}, {0x9e, 0x00, 0x05}, {0xa7, 0x00, 0x02},
+     {0x38, 0x00, 0x00}, {0x3d, 0x00, 0x01}, {0x0a, 0x00, 0x00}, {0x38, 0x00, 0x03}},
+    /* 44 */
+    {{0x14, 0x00, 0x01}, {0x66, 0x00, 0x01}, {0xb8, 0x00, 0x15}, {0x90, 0x00, 0x18},
+     {0x12, 0x00, 0x00}, {0x07, 0x00, 0x00}, {0xa3, 0x00, 0x05}, {0xa2, 0x00, 0x02},
+     {0x71, 0x00, 0x01}, {0x7b, 0x00, 0x02}, {0x14, 0x00, 0x00}, {0x71, 0x00, 0x07}},
+    /* 45 */
+    {{0x19, 0x00, 0x01}, {0x3d, 0x00, 0x01}, {0xa3, 0x00, 0x13}, {0xd8, 0x00, 0x24},
+     {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0xa8, 0x00, 0x05}, {0x9d, 0x00, 0x02},
+     {0xaa, 0x00, 0x02}, {0xb9, 0x00, 0x03}, {0x1e, 0x00, 0x01}, {0xaa, 0x00, 0x0b}},
+    /* 46 */
+    {{0x1e, 0x00, 0x02}, {0x14, 0x00, 0x00}, {0x8f, 0x00, 0x10}, {0xdf, 0x00, 0x25},
+     {0x3d, 0x00, 0x03}, {0x48, 0x00, 0x01}, {0xae, 0x00, 0x05}, {0x98, 0x00, 0x02},
+     {0xe3, 0x00, 0x03}, {0xf6, 0x00, 0x04}, {0x28, 0x00, 0x01}, {0xe3, 0x00, 0x0f}},
+    /* 47 */
+    {{0x23, 0x00, 0x02}, {0x00, 0x00, 0x00}, {0x7a, 0x00, 0x0e}, {0x97, 0x00, 0x19},
+     {0x7b, 0x00, 0x06}, {0x90, 0x00, 0x02}, {0xb3, 0x00, 0x05}, {0x92, 0x00, 0x02},
+     {0xe3, 0x00, 0x03}, {0xcb, 0x00, 0x03}, {0x33, 0x00, 0x01}, {0xe3, 0x00, 0x0f}},
+    /* 48 */
+    {{0x28, 0x00, 0x02}, {0x0a, 0x00, 0x00}, {0x66, 0x00, 0x0b}, {0x4f, 0x00, 0x0d},
+     {0xb9, 0x00, 0x09}, {0xd8, 0x00, 0x03}, {0xb8, 0x00, 0x06}, {0x8d, 0x00, 0x02},
+     {0xaa, 0x00, 0x02}, {0x8d, 0x00, 0x02}, {0x3d, 0x00, 0x02}, {0xaa, 0x00, 0x0b}},
+    /* 49 */
+    {{0x2e, 0x00, 0x03}, {0x14, 0x00, 0x01}, {0x51, 0x00, 0x09}, {0x07, 0x00, 0x01},
+     {0xf6, 0x00, 0x0c}, {0xdf, 0x00, 0x03}, {0xbd, 0x00, 0x06}, {0x88, 0x00, 0x02},
+     {0x71, 0x00, 0x01}, {0x50, 0x00, 0x01}, {0x47, 0x00, 0x02}, {0x71, 0x00, 0x07}},
+    /* 50 */
+    {{0x33, 0x00, 0x03}, {0x1e, 0x00, 0x01}, {0x3d, 0x00, 0x07}, {0x00, 0x00, 0x00},
+     {0xcb, 0x00, 0x0a}, {0x97, 0x00, 0x02}, {0xc2, 0x00, 0x06}, {0x83, 0x00, 0x02},
+     {0x38, 0x00, 0x00}, {0x12, 0x00, 0x00}, {0x51, 0x00, 0x02}, {0x38, 0x00, 0x03}},
+    /* 51 */
+    {{0x38, 0x00, 0x03}, {0x28, 0x00, 0x02}, {0x28, 0x00, 0x04}, {0x38, 0x00, 0x01},
+     {0x8d, 0x00, 0x07}, {0x4f, 0x00, 0x01}, {0xc7, 0x00, 0x06}, {0x7e, 0x00, 0x02},
+     {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x5c, 0x00, 0x03}, {0x00, 0x00, 0x00}},
+    /* 52 */
+    {{0x3d, 0x00, 0x04}, {0x33, 0x00, 0x02}, {0x14, 0x00, 0x02}, {0x71, 0x00, 0x03},
+     {0x50, 0x00, 0x04}, {0x07, 0x00, 0x00}, {0xcc, 0x00, 0x06}, {0x79, 0x00, 0x02},
+     {0x1e, 0x00, 0x00}, {0x19, 0x00, 0x00}, {0x66, 0x00, 0x03}, {0x48, 0x00, 0x01}},
+    /* 53 */
+    {{0x42, 0x00, 0x04}, {0x3d, 0x00, 0x03}, {0x00, 0x00, 0x00}, {0xaa, 0x00, 0x05},
+     {0x12, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0xd1, 0x00, 0x06}, {0x74, 0x00, 0x01},
+     {0x3d, 0x00, 0x01}, {0x33, 0x00, 0x00}, {0x70, 0x00, 0x03}, {0x90, 0x00, 0x02}},
+    /* 54 */
+    {{0x47, 0x00, 0x04}, {0x47, 0x00, 0x03}, {0x24, 0x00, 0x00}, {0xe3, 0x00, 0x07},
+     {0x00, 0x00, 0x00}, {0x28, 0x00, 0x00}, {0xd7, 0x00, 0x07}, {0x6f, 0x00, 0x01},
+     {0x5c, 0x00, 0x01}, {0x4c, 0x00, 0x01}, {0x7a, 0x00, 0x04}, {0xd8, 0x00, 0x03}},
+    /* 55 */
+    {{0x4c, 0x00, 0x05}, {0x51, 0x00, 0x04}, {0x48, 0x00, 0x01}, {0xe3, 0x00, 0x07},
+     {0x14, 0x00, 0x08}, {0x51, 0x00, 0x01}, {0xdc, 0x00, 0x07}, {0x69, 0x00, 0x01},
+     {0x7b, 0x00, 0x02}, {0x66, 0x00, 0x01}, {0x85, 0x00, 0x04}, {0xdf, 0x00, 0x03}},
+    /* 56 */
+    {{0x51, 0x00, 0x05}, {0x5c, 0x00, 0x04}, {0x6c, 0x00, 0x01}, {0xaa, 0x00, 0x05},
+     {0x28, 0x00, 0x10}, {0x7a, 0x00, 0x02}, {0xe1, 0x00, 0x07}, {0x64, 0x00, 0x01},
+     {0x9a, 0x00, 0x02}, {0x7f, 0x00, 0x02}, {0x8f, 0x00, 0x04}, {0x97, 0x00, 0x02}},
+    /* 57 */
+    {{0x57, 0x00, 0x05}, {0x66, 0x00, 0x05}, {0x90, 0x00, 0x02}, {0x71, 0x00, 0x03},
+     {0x3d, 0x00, 0x18}, {0xa3, 0x00, 0x02}, {0xe6, 0x00, 0x07}, {0x5f, 0x00, 0x01},
+     {0xb9, 0x00, 0x03}, {0x99, 0x00, 0x02}, {0x99, 0x00, 0x05}, {0x4f, 0x00, 0x01}},
+    /* 58 */
+    {{0x5c, 0x00, 0x06}, {0x70, 0x00, 0x05}, {0xb4, 0x00, 0x03}, {0x38, 0x00, 0x01},
+     {0x51, 0x00, 0x20}, {0xcc, 0x00, 0x03}, {0xeb, 0x00, 0x07}, {0x5a, 0x00, 0x01},
+     {0xd7, 0x00, 0x03}, {0xb3, 0x00, 0x02}, {0xa3, 0x00, 0x05}, {0x07, 0x00, 0x00}},
+    /* 59 */
+    {{0x61, 0x00, 0x06}, {0x7a, 0x00, 0x06}, {0xd8, 0x00, 0x03}, {0x00, 0x00, 0x00},
+     {0x66, 0x00, 0x28}, {0xf5, 0x00, 0x04}, {0xf0, 0x00, 0x08}, {0x55, 0x00, 0x01},
+     {0xf6, 0x00, 0x04}, {0xcc, 0x00, 0x03}, {0xae, 0x00, 0x05}, {0x00, 0x00, 0x00}},
+    /* 60 */
+    {{0x66, 0x00, 0x06}, {0x85, 0x00, 0x06}, {0xfc, 0x00, 0x04}, {0x4d, 0x00, 0x01},
+     {0x7a, 0x00, 0x31}, {0xe1, 0x00, 0x03}, {0xf5, 0x00, 0x08}, {0x50, 0x00, 0x01},
+     {0xea, 0x00, 0x03}, {0xe6, 0x00, 0x03}, {0xb8, 0x00, 0x06}, {0x0a, 0x00, 0x00}},
+    /* 61 */
+    {{0x6b, 0x00, 0x07}, {0x8f, 0x00, 0x07}, {0xdf, 0x00, 0x03}, {0x9b, 0x00, 0x02},
+     {0x8f, 0x00, 0x39}, {0xb8, 0x00, 0x03}, {0xfa, 0x00, 0x08}, {0x4b, 0x00, 0x01},
+     {0xcb, 0x00, 0x03}, {0xff, 0x00, 0x04}, {0xc2, 0x00, 0x06}, {0x14, 0x00, 0x00}},
+    /* 62 */
+    {{0x70, 0x00, 0x07}, {0x99, 0x00, 0x07}, {0xbb, 0x00, 0x03}, {0xe8, 0x00, 0x03},
+     {0xa3, 0x00, 0x41}, {0x8f, 0x00, 0x02}, {0xff, 0x00, 0x08}, {0x46, 0x00, 0x01},
+     {0xac, 0x00, 0x02}, {0xe6, 0x00, 0x03}, {0xcc, 0x00, 0x06}, {0x1e, 0x00, 0x00}},
+    /* 63 */
+    {{0x75, 0x00, 0x07}, {0xa3, 0x00, 0x08}, {0x97, 0x00, 0x02}, {0xc9, 0x00, 0x03},
+     {0xb8, 0x00, 0x49}, {0x66, 0x00, 0x01}, {0xfa, 0x00, 0x08}, {0x41, 0x00, 0x01},
+     {0x8d, 0x00, 0x02}, {0xcc, 0x00, 0x03}, {0xd7, 0x00, 0x07}, {0x28, 0x00, 0x00}},
+    /* 64 */
+    {{0x7a, 0x00, 0x08}, {0xae, 0x00, 0x08}, {0x73, 0x00, 0x01}, {0x7c, 0x00, 0x02},
+     {0xcc, 0x00, 0x51}, {0x3d, 0x00, 0x01}, {0xf5, 0x00, 0x08}, {0x3b, 0x00, 0x00},
+     {0x6f, 0x00, 0x01}, {0xb3, 0x00, 0x02}, {0xe1, 0x00, 0x07}, {0x33, 0x00, 0x00}},
+    /* 65 */
+    {{0x7f, 0x00, 0x08}, {0xb8, 0x00, 0x09}, {0x4f, 0x00, 0x01}, {0x2e, 0x00, 0x00},
+     {0xe1, 0x00, 0x5a}, {0x14, 0x00, 0x00}, {0xf0, 0x00, 0x08}, {0x36, 0x00, 0x00},
+     {0x50, 0x00, 0x01}, {0x99, 0x00, 0x02}, {0xeb, 0x00, 0x07}, {0x3d, 0x00, 0x01}},
+    /* 66 */
+    {{0x85, 0x00, 0x08}, {0xc2, 0x00, 0x09}, {0x2b, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0xf5, 0x00, 0x62}, {0x00, 0x00, 0x00}, {0xeb, 0x00, 0x07}, {0x31, 0x00, 0x00},
+     {0x31, 0x00, 0x00}, {0x7f, 0x00, 0x02}, {0xf5, 0x00, 0x08}, {0x47, 0x00, 0x01}},
+    /* 67 */
+    {{0x8a, 0x00, 0x09}, {0xcc, 0x00, 0x0a}, {0x07, 0x00, 0x00}, {0x24, 0x00, 0x09},
+     {0xf5, 0x00, 0x62}, {0x38, 0x00, 0x01}, {0xe6, 0x00, 0x07}, {0x2c, 0x00, 0x00},
+     {0x12, 0x00, 0x00}, {0x66, 0x00, 0x01}, {0xff, 0x00, 0x08}, {0x51, 0x00, 0x01}},
+    /* 68 */
+    {{0x8f, 0x00, 0x09}, {0xd7, 0x00, 0x0a}, {0x00, 0x00, 0x00}, {0x48, 0x00, 0x12},
+     {0xe1, 0x00, 0x5a}, {0x71, 0x00, 0x03}, {0xe1, 0x00, 0x07}, {0x27, 0x00, 0x00},
+     {0x00, 0x00, 0x00}, {0x4c, 0x00, 0x01}, {0xf5, 0x00, 0x08}, {0x5c, 0x00, 0x01}},
+    /* 69 */
+    {{0x94, 0x00, 0x09}, {0xe1, 0x00, 0x0b}, {0x4d, 0x00, 0x4d}, {0x6c, 0x00, 0x1b},
+     {0xcc, 0x00, 0x51}, {0xaa, 0x00, 0x05}, {0xdc, 0x00, 0x07}, {0x22, 0x00, 0x00},
+     {0x1e, 0x00, 0x01}, {0x33, 0x00, 0x00}, {0xeb, 0x00, 0x07}, {0x66, 0x00, 0x01}},
+    /* 70 */
+    {{0x99, 0x00, 0x0a}, {0xeb, 0x00, 0x0b}, {0x9b, 0x00, 0x9b}, {0x90, 0x00, 0x24},
+     {0xb8, 0x00, 0x49}, {0xe3, 0x00, 0x07}, {0xd7, 0x00, 0x07}, {0x1d, 0x00, 0x00},
+     {0x3d, 0x00, 0x02}, {0x19, 0x00, 0x00}, {0xe1, 0x00, 0x07}, {0x70, 0x00, 0x01}},
+    /* 71 */
+    {{0x9e, 0x00, 0x0a}, {0xf5, 0x00, 0x0c}, {0xe8, 0x00, 0xe8}, {0xb4, 0x00, 0x2d},
+     {0xa3, 0x00, 0x41}, {0xe3, 0x00, 0x07}, {0xd1, 0x00, 0x06}, {0x18, 0x00, 0x00},
+     {0x5c, 0x00, 0x03}, {0x00, 0x00, 0x00}, {0xd7, 0x00, 0x07}, {0x7a, 0x00, 0x02}},
+    /* 72 */
+    {{0xa3, 0x00, 0x0a}, {0xff, 0x00, 0x0c}, {0xc9, 0x00, 0xc9}, {0xd8, 0x00, 0x36},
+     {0x8f, 0x00, 0x39}, {0xaa, 0x00, 0x05}, {0xcc, 0x00, 0x06}, {0x12, 0x00, 0x00},
+     {0x7b, 0x00, 0x04}, {0x0f, 0x00, 0x00}, {0xcc, 0x00, 0x06}, {0x85, 0x00, 0x02}},
+    /* 73 */
+    {{0xa8, 0x00, 0x0b}, {0xf5, 0x00, 0x0c}, {0x7c, 0x00, 0x7c}, {0xfc, 0x00, 0x3f},
+     {0x7a, 0x00, 0x31}, {0x71, 0x00, 0x03}, {0xc7, 0x00, 0x06}, {0x0d, 0x00, 0x00},
+     {0x9a, 0x00, 0x05}, {0x1e, 0x00, 0x01}, {0xc2, 0x00, 0x06}, {0x8f, 0x00, 0x02}},
+    /* 74 */
+    {{0xae, 0x00, 0x0b}, {0xeb, 0x00, 0x0b}, {0x2e, 0x00, 0x2e}, {0xdf, 0x00, 0x37},
+     {0x66, 0x00, 0x28}, {0x38, 0x00, 0x01}, {0xc2, 0x00, 0x06}, {0x08, 0x00, 0x00},
+     {0xb9, 0x00, 0x06}, {0x2e, 0x00, 0x02}, {0xb8, 0x00, 0x06}, {0x99, 0x00, 0x02}},
+    /* 75 */
+    {{0xb3, 0x00, 0x0b}, {0xe1, 0x00, 0x0b}, {0x00, 0x00, 0x00}, {0xbb, 0x00, 0x2e},
+     {0x51, 0x00, 0x20}, {0x00, 0x00, 0x00}, {0xbd, 0x00, 0x06}, {0x03, 0x00, 0x00},
+     {0xd7, 0x00, 0x07}, {0x3d, 0x00, 0x03}, {0xae, 0x00, 0x05}, {0xa3, 0x00, 0x02}},
+    /* 76 */
+    {{0xb8, 0x00, 0x0c}, {0xd7, 0x00, 0x0a}, {0x33, 0x00, 0x22}, {0x97, 0x00, 0x25},
+     {0x3d, 0x00, 0x18}, {0x05, 0x00, 0x00}, {0xb8, 0x00, 0x06}, {0x00, 0x00, 0x00},
+     {0xf6, 0x00, 0x08}, {0x4c, 0x00, 0x03}, {0xa3, 0x00, 0x05}, {0xae, 0x00, 0x02}},
+    /* 77 */
+    {{0xbd, 0x00, 0x0c}, {0xcc, 0x00, 0x0a}, {0x66, 0x00, 0x44}, {0x73, 0x00, 0x1c},
+     {0x28, 0x00, 0x10}, {0x0a, 0x00, 0x00}, {0xb3, 0x00, 0x05}, {0x28, 0x00, 0x04},
+     {0xea, 0x00, 0x07}, {0x5c, 0x00, 0x04}, {0x99, 0x00, 0x05}, {0xb8, 0x00, 0x03}},
+    /* 78 */
+    {{0xc2, 0x00, 0x0c}, {0xc2, 0x00, 0x09}, {0x99, 0x00, 0x66}, {0x4f, 0x00, 0x13},
+     {0x14, 0x00, 0x08}, {0x0f, 0x00, 0x00}, {0xae, 0x00, 0x05}, {0x51, 0x00, 0x08},
+     {0xcb, 0x00, 0x06}, {0x6b, 0x00, 0x05}, {0x8f, 0x00, 0x04}, {0xc2, 0x00, 0x03}},
+    /* 79 */
+    {{0xc7, 0x00, 0x0d}, {0xb8, 0x00, 0x09}, {0xcc, 0x00, 0x88}, {0x2b, 0x00, 0x0a},
+     {0x00, 0x00, 0x00}, {0x14, 0x00, 0x00}, {0xa8, 0x00, 0x05}, {0x7a, 0x00, 0x0c},
+     {0xac, 0x00, 0x05}, {0x7b, 0x00, 0x06}, {0x85, 0x00, 0x04}, {0xcc, 0x00, 0x03}},
+    /* 80 */
+    {{0xcc, 0x00, 0x0d}, {0xae, 0x00, 0x08}, {0xff, 0x00, 0xaa}, {0x07, 0x00, 0x01},
+     {0x52, 0x00, 0x01}, {0x19, 0x00, 0x00}, {0xa3, 0x00, 0x05}, {0xa3, 0x00, 0x10},
+     {0x8d, 0x00, 0x04}, {0x8a, 0x00, 0x06}, {0x7a, 0x00, 0x04}, {0xd7, 0x00, 0x03}},
+    /* 81 */
+    {{0xd1, 0x00, 0x0d}, {0xa3, 0x00, 0x08}, {0xcc, 0x00, 0x88}, {0x00, 0x00, 0x00},
+     {0xa5, 0x00, 0x02}, {0x1e, 0x00, 0x00}, {0x9e, 0x00, 0x05}, {0xcc, 0x00, 0x14},
+     {0x6f, 0x00, 0x03}, {0x99, 0x00, 0x07}, {0x70, 0x00, 0x03}, {0xe1, 0x00, 0x03}},
+    /* 82 */
+    {{0xd7, 0x00, 0x0e}, {0x99, 0x00, 0x07}, {0x99, 0x00, 0x66}, {0x2e, 0x00, 0x06},
+     {0xf7, 0x00, 0x04}, {0x23, 0x00, 0x00}, {0x99, 0x00, 0x05}, {0xf5, 0x00, 0x18},
+     {0x50, 0x00, 0x02}, {0xa9, 0x00, 0x08}, {0x66, 0x00, 0x03}, {0xeb, 0x00, 0x03}},
+    /* 83 */
+    {{0xdc, 0x00, 0x0e}, {0x8f, 0x00, 0x07}, {0x66, 0x00, 0x44}, {0x5c, 0x00, 0x0c},
+     {0xb5, 0x00, 0x03}, {0x28, 0x00, 0x00}, {0x94, 0x00, 0x04}, {0xe1, 0x00, 0x16},
+     {0x31, 0x00, 0x01}, {0xb8, 0x00, 0x09}, {0x5c, 0x00, 0x03}, {0xf5, 0x00, 0x04}},
+    /* 84 */
+    {{0xe1, 0x00, 0x0f}, {0x85, 0x00, 0x06}, {0x33, 0x00, 0x22}, {0x8a, 0x00, 0x12},
+     {0x63, 0x00, 0x01}, {0x2e, 0x00, 0x00}, {0x8f, 0x00, 0x04}, {0xb8, 0x00, 0x12},
+     {0x12, 0x00, 0x00}, {0xc7, 0x00, 0x09}, {0x51, 0x00, 0x02}, {0xff, 0x00, 0x04}},
+    /* 85 */
+    {{0xe6, 0x00, 0x0f}, {0x7a, 0x00, 0x06}, {0x00, 0x00, 0x00}, {0xb8, 0x00, 0x18},
+     {0x10, 0x00, 0x00}, {0x33, 0x00, 0x00}, {0x8a, 0x00, 0x04}, {0x8f, 0x00, 0x0e},
+     {0x00, 0x00, 0x00}, {0xd7, 0x00, 0x0a}, {0x47, 0x00, 0x02}, {0xf5, 0x00, 0x04}},
+    /* 86 */
+    {{0xeb, 0x00, 0x0f}, {0x70, 0x00, 0x05}, {0x0f, 0x00, 0x00}, {0xe6, 0x00, 0x1e},
+     {0x00, 0x00, 0x00}, {0x38, 0x00, 0x00}, {0x85, 0x00, 0x04}, {0x66, 0x00, 0x0a},
+     {0x19, 0x00, 0x02}, {0xe6, 0x00, 0x0b}, {0x3d, 0x00, 0x02}, {0xeb, 0x00, 0x03}},
+    /* 87 */
+    {{0xf0, 0x00, 0x10}, {0x66, 0x00, 0x05}, {0x1e, 0x00, 0x00}, {0xeb, 0x00, 0x1f},
+     {0x3d, 0x00, 0x0a}, {0x3d, 0x00, 0x01}, {0x7f, 0x00, 0x04}, {0x3d, 0x00, 0x06},
+     {0x33, 0x00, 0x05}, {0xf6, 0x00, 0x0c}, {0x33, 0x00, 0x01}, {0xe1, 0x00, 0x03}},
+    /* 88 */
+    {{0xf5, 0x00, 0x10}, {0x5c, 0x00, 0x04}, {0x2e, 0x00, 0x00}, {0xbd, 0x00, 0x19},
+     {0x7b, 0x00, 0x14}, {0x42, 0x00, 0x01}, {0x7a, 0x00, 0x04}, {0x14, 0x00, 0x02},
+     {0x4c, 0x00, 0x08}, {0xfa, 0x00, 0x0c}, {0x28, 0x00, 0x01}, {0xd7, 0x00, 0x03}},
+    /* 89 */
+    {{0xfa, 0x00, 0x10}, {0x51, 0x00, 0x04}, {0x3d, 0x00, 0x01}, {0x8e, 0x00, 0x13},
+     {0xb9, 0x00, 0x1e}, {0x47, 0x00, 0x01}, {0x75, 0x00, 0x03}, {0x00, 0x00, 0x00},
+     {0x66, 0x00, 0x0b}, {0xeb, 0x00, 0x0b}, {0x1e, 0x00, 0x01}, {0xcc, 0x00, 0x03}},
+    /* 90 */
+    {{0xff, 0x00, 0x11}, {0x47, 0x00, 0x03}, {0x4c, 0x00, 0x01}, {0x60, 0x00, 0x0c},
+     {0xf6, 0x00, 0x29}, {0x4c, 0x00, 0x01}, {0x70, 0x00, 0x03}, {0x3d, 0x00, 0x03},
+     {0x7f, 0x00, 0x0e}, {0xdb, 0x00, 0x0a}, {0x14, 0x00, 0x00}, {0xc2, 0x00, 0x03}},
+    /* 91 */
+    {{0xfa, 0x00, 0x10}, {0x3d, 0x00, 0x03}, {0x5c, 0x00, 0x01}, {0x32, 0x00, 0x06},
+     {0xcb, 0x00, 0x21}, {0x51, 0x00, 0x01}, {0x6b, 0x00, 0x03}, {0x7b, 0x00, 0x06},
+     {0x99, 0x00, 0x11}, {0xcc, 0x00, 0x0a}, {0x0a, 0x00, 0x00}, {0xb8, 0x00, 0x03}},
+    /* 92 */
+    {{0xf5, 0x00, 0x10}, {0x33, 0x00, 0x02}, {0x6b, 0x00, 0x01}, {0x04, 0x00, 0x00},
+     {0x8d, 0x00, 0x17}, {0x57, 0x00, 0x01}, {0x66, 0x00, 0x03}, {0xb9, 0x00, 0x09},
+     {0xb3, 0x00, 0x14}, {0xbd, 0x00, 0x09}, {0x00, 0x00, 0x00}, {0xae, 0x00, 0x02}},
+    /* 93 */
+    {{0xf0, 0x00, 0x10}, {0x28, 0x00, 0x02}, {0x7b, 0x00, 0x02}, {0x00, 0x00, 0x00},
+     {0x50, 0x00, 0x0d}, {0x5c, 0x00, 0x01}, {0x61, 0x00, 0x03}, {0xf6, 0x00, 0x0c},
+     {0xcc, 0x00, 0x17}, {0xad, 0x00, 0x08}, {0x43, 0x00, 0x01}, {0xa3, 0x00, 0x02}},
+    /* 94 */
+    {{0xeb, 0x00, 0x0f}, {0x1e, 0x00, 0x01}, {0x8a, 0x00, 0x02}, {0x05, 0x00, 0x00},
+     {0x12, 0x00, 0x03}, {0x61, 0x00, 0x01}, {0x5c, 0x00, 0x03}, {0xcb, 0x00, 0x0a},
+     {0xe6, 0x00, 0x1a}, {0x9e, 0x00, 0x07}, {0x86, 0x00, 0x02}, {0x99, 0x00, 0x02}},
+    /* 95 */
+    {{0xe6, 0x00, 0x0f}, {0x14, 0x00, 0x01}, {0x99, 0x00, 0x02}, {0x0a, 0x00, 0x00},
+     {0x00, 0x00, 0x00}, {0x66, 0x00, 0x01}, {0x57, 0x00, 0x02}, {0x8d, 0x00, 0x07},
+     {0xff, 0x00, 0x1d}, {0x8e, 0x00, 0x07}, {0xca, 0x00, 0x03}, {0x8f, 0x00, 0x02}},
+    /* 96 */
+    {{0xe1, 0x00, 0x0f}, {0x0a, 0x00, 0x00}, {0xa9, 0x00, 0x02}, {0x0f, 0x00, 0x00},
+     {0x19, 0x00, 0x00}, {0x6b, 0x00, 0x01}, {0x51, 0x00, 0x02}, {0x50, 0x00, 0x04},
+     {0xe6, 0x00, 0x1a}, {0x7f, 0x00, 0x06}, {0xf2, 0x00, 0x04}, {0x85, 0x00, 0x02}},
+    /* 97 */
+    {{0xdc, 0x00, 0x0e}, {0x00, 0x00, 0x00}, {0xb8, 0x00, 0x03}, {0x14, 0x00, 0x00},
+     {0x33, 0x00, 0x00}, {0x70, 0x00, 0x01}, {0x4c, 0x00, 0x02}, {0x12, 0x00, 0x00},
+     {0xcc, 0x00, 0x17}, {0x70, 0x00, 0x05}, {0xaf, 0x00, 0x02}, {0x7a, 0x00, 0x02}},
+    /* 98 */
+    {{0xd7, 0x00, 0x0e}, {0x24, 0x00, 0x01}, {0xc7, 0x00, 0x03}, {0x19, 0x00, 0x00},
+     {0x4c, 0x00, 0x01}, {0x75, 0x00, 0x01}, {0x47, 0x00, 0x02}, {0x00, 0x00, 0x00},
+     {0xb3, 0x00, 0x14}, {0x60, 0x00, 0x04}, {0x6b, 0x00, 0x01}, {0x70, 0x00, 0x01}},
+    /* 99 */
+    {{0xd1, 0x00, 0x0d}, {0x48, 0x00, 0x03}, {0xd7, 0x00, 0x03}, {0x1e, 0x00, 0x00},
+     {0x66, 0x00, 0x01}, {0x7a, 0x00, 0x02}, {0x42, 0x00, 0x02}, {0x19, 0x00, 0x02},
+     {0x99, 0x00, 0x11}, {0x51, 0x00, 0x04}, {0x28, 0x00, 0x00}, {0x66, 0x00, 0x01}},
+};
@@ -0,0 +1,613 @@
+/*
+ * Copyright (c) 2024 Kuba Birecki
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#pragma once
+
+/**
+ * Frames of wpm.overlay, recorded with CONFIG_RGB_FX_GOLDEN_RECORD=y.
+ */
+static const uint8_t golden_frames[][RGB_FX_NUM_PIXELS][3] = {
+    /* 0 */
+    {{0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}},
+    /* 1 */
+    {{0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}},
+    /* 2 */
+    {{0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}},
+    /* 3 */
+    {{0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}},
+    /* 4 */
+    {{0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}},
+    /* 5 */
+    {{0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}},
+    /* 6 */
+    {{0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}},
+    /* 7 */
+    {{0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}},
+    /* 8 */
+    {{0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}},
+    /* 9 */
+    {{0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}},
+    /* 10 */
+    {{0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}},
+    /* 11 */
+    {{0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}},
+    /* 12 */
+    {{0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}},
+    /* 13 */
+    {{0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}},
+    /* 14 */
+    {{0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}},
+    /* 15 */
+    {{0x00, 0x06, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0x00, 0x06, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0x00, 0x06, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}},
+    /* 16 */
+    {{0x00, 0x13, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0x00, 0x13, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0x00, 0x13, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}},
+    /* 17 */
+    {{0x01, 0x26, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0x01, 0x26, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0x01, 0x26, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}},
+    /* 18 */
+    {{0x02, 0x39, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0x02, 0x39, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0x02, 0x39, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}},
+    /* 19 */
+    {{0x05, 0x46, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0x05, 0x46, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0x05, 0x46, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}},
+    /* 20 */
+    {{0x08, 0x59, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0x08, 0x59, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0x08, 0x59, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}},
+    /* 21 */
+    {{0x0b, 0x66, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0x0b, 0x66, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0x0b, 0x66, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}},
+    /* 22 */
+    {{0x10, 0x79, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0x10, 0x79, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0x10, 0x79, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}},
+    /* 23 */
+    {{0x15, 0x8c, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0x15, 0x8c, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0x15, 0x8c, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}},
+    /* 24 */
+    {{0x19, 0x99, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0x19, 0x99, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0x19, 0x99, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}},
+    /* 25 */
+    {{0x1f, 0xac, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0x1f, 0xac, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0x1f, 0xac, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}},
+    /* 26 */
+    {{0x26, 0xbf, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0x26, 0xbf, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0x26, 0xbf, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}},
+    /* 27 */
+    {{0x2c, 0xcc, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0x2c, 0xcc, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0x2c, 0xcc, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}},
+    /* 28 */
+    {{0x38, 0xdf, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0x38, 0xdf, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0x38, 0xdf, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}},
+    /* 29 */
+    {{0x3f, 0xec, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0x3f, 0xec, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0x3f, 0xec, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}},
+    /* 30 */
+    {{0x48, 0xff, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0x48, 0xff, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0x48, 0xff, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}},
+    /* 31 */
+    {{0x4c, 0xff, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0x4c, 0xff, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0x4c, 0xff, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}},
+    /* 32 */
+    {{0x51, 0xff, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0x51, 0xff, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0x51, 0xff, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}},
+    /* 33 */
+    {{0x59, 0xff, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0x59, 0xff, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0x59, 0xff, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}},
+    /* 34 */
+    {{0x5d, 0xff, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0x5d, 0xff, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0x5d, 0xff, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}},
+    /* 35 */
+    {{0x62, 0xff, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0x62, 0xff, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0x62, 0xff, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}},
+    /* 36 */
+    {{0x66, 0xff, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0x66, 0xff, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0x66, 0xff, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}},
+    /* 37 */
+    {{0x6a, 0xff, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0x6a, 0xff, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0x6a, 0xff, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}},
+    /* 38 */
+    {{0x73, 0xff, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0x73, 0xff, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0x73, 0xff, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}},
+    /* 39 */
+    {{0x77, 0xff, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0x77, 0xff, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0x77, 0xff, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}},
+    /* 40 */
+    {{0x7b, 0xff, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0x7b, 0xff, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0x7b, 0xff, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}},
+    /* 41 */
+    {{0x80, 0xff, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0x80, 0xff, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0x80, 0xff, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}},
+    /* 42 */
+    {{0x84, 0xff, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0x84, 0xff, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0x84, 0xff, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}},
+    /* 43 */
+    {{0x8c, 0xff, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0x8c, 0xff, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0x8c, 0xff, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}},
+    /* 44 */
+    {{0x91, 0xff, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0x91, 0xff, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0x91, 0xff, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}},
+    /* 45 */
+    {{0x95, 0xff, 0x00}, {0x07, 0x0c, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0x95, 0xff, 0x00}, {0x07, 0x0c, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0x95, 0xff, 0x00}, {0x07, 0x0c, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}},
+    /* 46 */
+    {{0x99, 0xff, 0x00}, {0x0f, 0x19, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0x99, 0xff, 0x00}, {0x0f, 0x19, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0x99, 0xff, 0x00}, {0x0f, 0x19, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}},
+    /* 47 */
+    {{0x9d, 0xff, 0x00}, {0x1b, 0x2c, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0x9d, 0xff, 0x00}, {0x1b, 0x2c, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0x9d, 0xff, 0x00}, {0x1b, 0x2c, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}},
+    /* 48 */
+    {{0xa2, 0xff, 0x00}, {0x24, 0x39, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0xa2, 0xff, 0x00}, {0x24, 0x39, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0xa2, 0xff, 0x00}, {0x24, 0x39, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}},
+    /* 49 */
+    {{0xa6, 0xff, 0x00}, {0x31, 0x4c, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0xa6, 0xff, 0x00}, {0x31, 0x4c, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0xa6, 0xff, 0x00}, {0x31, 0x4c, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}},
+    /* 50 */
+    {{0xaa, 0xff, 0x00}, {0x3b, 0x59, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0xaa, 0xff, 0x00}, {0x3b, 0x59, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0xaa, 0xff, 0x00}, {0x3b, 0x59, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}},
+    /* 51 */
+    {{0xae, 0xff, 0x00}, {0x45, 0x66, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0xae, 0xff, 0x00}, {0x45, 0x66, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0xae, 0xff, 0x00}, {0x45, 0x66, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}},
+    /* 52 */
+    {{0xb3, 0xff, 0x00}, {0x55, 0x79, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0xb3, 0xff, 0x00}, {0x55, 0x79, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0xb3, 0xff, 0x00}, {0x55, 0x79, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}},
+    /* 53 */
+    {{0xb7, 0xff, 0x00}, {0x60, 0x86, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0xb7, 0xff, 0x00}, {0x60, 0x86, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0xb7, 0xff, 0x00}, {0x60, 0x86, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}},
+    /* 54 */
+    {{0xbb, 0xff, 0x00}, {0x70, 0x99, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0xbb, 0xff, 0x00}, {0x70, 0x99, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0xbb, 0xff, 0x00}, {0x70, 0x99, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}},
+    /* 55 */
+    {{0xbf, 0xff, 0x00}, {0x7c, 0xa6, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0xbf, 0xff, 0x00}, {0x7c, 0xa6, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0xbf, 0xff, 0x00}, {0x7c, 0xa6, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}},
+    /* 56 */
+    {{0xc4, 0xff, 0x00}, {0x8e, 0xb9, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0xc4, 0xff, 0x00}, {0x8e, 0xb9, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0xc4, 0xff, 0x00}, {0x8e, 0xb9, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}},
+    /* 57 */
+    {{0xc8, 0xff, 0x00}, {0x9b, 0xc6, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0xc8, 0xff, 0x00}, {0x9b, 0xc6, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0xc8, 0xff, 0x00}, {0x9b, 0xc6, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}},
+    /* 58 */
+    {{0xcc, 0xff, 0x00}, {0xa8, 0xd3, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0xcc, 0xff, 0x00}, {0xa8, 0xd3, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0xcc, 0xff, 0x00}, {0xa8, 0xd3, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}},
+    /* 59 */
+    {{0xd1, 0xff, 0x00}, {0xbc, 0xe6, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0xd1, 0xff, 0x00}, {0xbc, 0xe6, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0xd1, 0xff, 0x00}, {0xbc, 0xe6, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}},
+    /* 60 */
+    {{0xd5, 0xff, 0x00}, {0xca, 0xf3, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0xd5, 0xff, 0x00}, {0xca, 0xf3, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0xd5, 0xff, 0x00}, {0xca, 0xf3, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}},
+    /* 61 */
+    {{0xd9, 0xff, 0x00}, {0xd9, 0xff, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0xd9, 0xff, 0x00}, {0xd9, 0xff, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0xd9, 0xff, 0x00}, {0xd9, 0xff, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}},
+    /* 62 */
+    {{0xdd, 0xff, 0x00}, {0xdd, 0xff, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0xdd, 0xff, 0x00}, {0xdd, 0xff, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0xdd, 0xff, 0x00}, {0xdd, 0xff, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}},
+    /* 63 */
+    {{0xe2, 0xff, 0x00}, {0xe2, 0xff, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0xe2, 0xff, 0x00}, {0xe2, 0xff, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0xe2, 0xff, 0x00}, {0xe2, 0xff, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}},
+    /* 64 */
+    {{0xe6, 0xff, 0x00}, {0xe6, 0xff, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0xe6, 0xff, 0x00}, {0xe6, 0xff, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0xe6, 0xff, 0x00}, {0xe6, 0xff, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}},
+    /* 65 */
+    {{0xea, 0xff, 0x00}, {0xea, 0xff, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0xea, 0xff, 0x00}, {0xea, 0xff, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0xea, 0xff, 0x00}, {0xea, 0xff, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}},
+    /* 66 */
+    {{0xee, 0xff, 0x00}, {0xee, 0xff, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0xee, 0xff, 0x00}, {0xee, 0xff, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0xee, 0xff, 0x00}, {0xee, 0xff, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}},
+    /* 67 */
+    {{0xf3, 0xff, 0x00}, {0xf3, 0xff, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0xf3, 0xff, 0x00}, {0xf3, 0xff, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0xf3, 0xff, 0x00}, {0xf3, 0xff, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}},
+    /* 68 */
+    {{0xf3, 0xff, 0x00}, {0xf3, 0xff, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0xf3, 0xff, 0x00}, {0xf3, 0xff, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0xf3, 0xff, 0x00}, {0xf3, 0xff, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}},
+    /* 69 */
+    {{0xf7, 0xff, 0x00}, {0xf7, 0xff, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0xf7, 0xff, 0x00}, {0xf7, 0xff, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0xf7, 0xff, 0x00}, {0xf7, 0xff, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}},
+    /* 70 */
+    {{0xfb, 0xff, 0x00}, {0xfb, 0xff, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0xfb, 0xff, 0x00}, {0xfb, 0xff, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0xfb, 0xff, 0x00}, {0xfb, 0xff, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}},
+    /* 71 */
+    {{0xff, 0xff, 0x00}, {0xff, 0xff, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0xff, 0xff, 0x00}, {0xff, 0xff, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0xff, 0xff, 0x00}, {0xff, 0xff, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}},
+    /* 72 */
+    {{0xff, 0xfb, 0x00}, {0xff, 0xfb, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0xff, 0xfb, 0x00}, {0xff, 0xfb, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0xff, 0xfb, 0x00}, {0xff, 0xfb, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}},
+    /* 73 */
+    {{0xff, 0xf7, 0x00}, {0xff, 0xf7, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0xff, 0xf7, 0x00}, {0xff, 0xf7, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0xff, 0xf7, 0x00}, {0xff, 0xf7, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}},
+    /* 74 */
+    {{0xff, 0xf3, 0x00}, {0xff, 0xf3, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0xff, 0xf3, 0x00}, {0xff, 0xf3, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0xff, 0xf3, 0x00}, {0xff, 0xf3, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}},
+    /* 75 */
+    {{0xff, 0xf3, 0x00}, {0xff, 0xf3, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0xff, 0xf3, 0x00}, {0xff, 0xf3, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0xff, 0xf3, 0x00}, {0xff, 0xf3, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}},
+    /* 76 */
+    {{0xff, 0xee, 0x00}, {0xff, 0xee, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0xff, 0xee, 0x00}, {0xff, 0xee, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0xff, 0xee, 0x00}, {0xff, 0xee, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}},
+    /* 77 */
+    {{0xff, 0xea, 0x00}, {0xff, 0xea, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0xff, 0xea, 0x00}, {0xff, 0xea, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0xff, 0xea, 0x00}, {0xff, 0xea, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}},
+    /* 78 */
+    {{0xff, 0xe6, 0x00}, {0xff, 0xe6, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0xff, 0xe6, 0x00}, {0xff, 0xe6, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0xff, 0xe6, 0x00}, {0xff, 0xe6, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}},
+    /* 79 */
+    {{0xff, 0xe6, 0x00}, {0xff, 0xe6, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0xff, 0xe6, 0x00}, {0xff, 0xe6, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0xff, 0xe6, 0x00}, {0xff, 0xe6, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}},
+    /* 80 */
+    {{0xff, 0xe2, 0x00}, {0xff, 0xe2, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0xff, 0xe2, 0x00}, {0xff, 0xe2, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0xff, 0xe2, 0x00}, {0xff, 0xe2, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}},
+    /* 81 */
+    {{0xff, 0xdd, 0x00}, {0xff, 0xdd, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0xff, 0xdd, 0x00}, {0xff, 0xdd, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0xff, 0xdd, 0x00}, {0xff, 0xdd, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}},
+    /* 82 */
+    {{0xff, 0xdd, 0x00}, {0xff, 0xdd, 0x00}, {0x06, 0x05, 0x00}, {0x00, 0x00, 0x00},
+     {0xff, 0xdd, 0x00}, {0xff, 0xdd, 0x00}, {0x06, 0x05, 0x00}, {0x00, 0x00, 0x00},
+     {0xff, 0xdd, 0x00}, {0xff, 0xdd, 0x00}, {0x06, 0x05, 0x00}, {0x00, 0x00, 0x00}},
+    /* 83 */
+    {{0xff, 0xd9, 0x00}, {0xff, 0xd9, 0x00}, {0x0c, 0x0a, 0x00}, {0x00, 0x00, 0x00},
+     {0xff, 0xd9, 0x00}, {0xff, 0xd9, 0x00}, {0x0c, 0x0a, 0x00}, {0x00, 0x00, 0x00},
+     {0xff, 0xd9, 0x00}, {0xff, 0xd9, 0x00}, {0x0c, 0x0a, 0x00}, {0x00, 0x00, 0x00}},
+    /* 84 */
+    {{0xff, 0xd5, 0x00}, {0xff, 0xd5, 0x00}, {0x19, 0x15, 0x00}, {0x00, 0x00, 0x00},
+     {0xff, 0xd5, 0x00}, {0xff, 0xd5, 0x00}, {0x19, 0x15, 0x00}, {0x00, 0x00, 0x00},
+     {0xff, 0xd5, 0x00}, {0xff, 0xd5, 0x00}, {0x19, 0x15, 0x00}, {0x00, 0x00, 0x00}},
+    /* 85 */
+    {{0xff, 0xd1, 0x00}, {0xff, 0xd1, 0x00}, {0x26, 0x1f, 0x00}, {0x00, 0x00, 0x00},
+     {0xff, 0xd1, 0x00}, {0xff, 0xd1, 0x00}, {0x26, 0x1f, 0x00}, {0x00, 0x00, 0x00},
+     {0xff, 0xd1, 0x00}, {0xff, 0xd1, 0x00}, {0x26, 0x1f, 0x00}, {0x00, 0x00, 0x00}},
+    /* 86 */
+    {{0xff, 0xd1, 0x00}, {0xff, 0xd1, 0x00}, {0x2c, 0x24, 0x00}, {0x00, 0x00, 0x00},
+     {0xff, 0xd1, 0x00}, {0xff, 0xd1, 0x00}, {0x2c, 0x24, 0x00}, {0x00, 0x00, 0x00},
+     {0xff, 0xd1, 0x00}, {0xff, 0xd1, 0x00}, {0x2c, 0x24, 0x00}, {0x00, 0x00, 0x00}},
+    /* 87 */
+    {{0xff, 0xcc, 0x00}, {0xff, 0xcc, 0x00}, {0x39, 0x2e, 0x00}, {0x00, 0x00, 0x00},
+     {0xff, 0xcc, 0x00}, {0xff, 0xcc, 0x00}, {0x39, 0x2e, 0x00}, {0x00, 0x00, 0x00},
+     {0xff, 0xcc, 0x00}, {0xff, 0xcc, 0x00}, {0x39, 0x2e, 0x00}, {0x00, 0x00, 0x00}},
+    /* 88 */
+    {{0xff, 0xc8, 0x00}, {0xff, 0xc8, 0x00}, {0x46, 0x37, 0x00}, {0x00, 0x00, 0x00},
+     {0xff, 0xc8, 0x00}, {0xff, 0xc8, 0x00}, {0x46, 0x37, 0x00}, {0x00, 0x00, 0x00},
+     {0xff, 0xc8, 0x00}, {0xff, 0xc8, 0x00}, {0x46, 0x37, 0x00}, {0x00, 0x00, 0x00}},
+    /* 89 */
+    {{0xff, 0xc4, 0x00}, {0xff, 0xc4, 0x00}, {0x4c, 0x3a, 0x00}, {0x00, 0x00, 0x00},
+     {0xff, 0xc4, 0x00}, {0xff, 0xc4, 0x00}, {0x4c, 0x3a, 0x00}, {0x00, 0x00, 0x00},
+     {0xff, 0xc4, 0x00}, {0xff, 0xc4, 0x00}, {0x4c, 0x3a, 0x00}, {0x00, 0x00, 0x00}},
+    /* 90 */
+    {{0xff, 0xc4, 0x00}, {0xff, 0xc4, 0x00}, {0x59, 0x44, 0x00}, {0x00, 0x00, 0x00},
+     {0xff, 0xc4, 0x00}, {0xff, 0xc4, 0x00}, {0x59, 0x44, 0x00}, {0x00, 0x00, 0x00},
+     {0xff, 0xc4, 0x00}, {0xff, 0xc4, 0x00}, {0x59, 0x44, 0x00}, {0x00, 0x00, 0x00}},
+    /* 91 */
+    {{0xff, 0xbf, 0x00}, {0xff, 0xbf, 0x00}, {0x5f, 0x47, 0x00}, {0x00, 0x00, 0x00},
+     {0xff, 0xbf, 0x00}, {0xff, 0xbf, 0x00}, {0x5f, 0x47, 0x00}, {0x00, 0x00, 0x00},
+     {0xff, 0xbf, 0x00}, {0xff, 0xbf, 0x00}, {0x5f, 0x47, 0x00}, {0x00, 0x00, 0x00}},
+    /* 92 */
+    {{0xff, 0xbf, 0x00}, {0xff, 0xbf, 0x00}, {0x66, 0x4c, 0x00}, {0x00, 0x00, 0x00},
+     {0xff, 0xbf, 0x00}, {0xff, 0xbf, 0x00}, {0x66, 0x4c, 0x00}, {0x00, 0x00, 0x00},
+     {0xff, 0xbf, 0x00}, {0xff, 0xbf, 0x00}, {0x66, 0x4c, 0x00}, {0x00, 0x00, 0x00}},
+    /* 93 */
+    {{0xff, 0xbb, 0x00}, {0xff, 0xbb, 0x00}, {0x6c, 0x4f, 0x00}, {0x00, 0x00, 0x00},
+     {0xff, 0xbb, 0x00}, {0xff, 0xbb, 0x00}, {0x6c, 0x4f, 0x00}, {0x00, 0x00, 0x00},
+     {0xff, 0xbb, 0x00}, {0xff, 0xbb, 0x00}, {0x6c, 0x4f, 0x00}, {0x00, 0x00, 0x00}},
+    /* 94 */
+    {{0xff, 0xbb, 0x00}, {0xff, 0xbb, 0x00}, {0x73, 0x54, 0x00}, {0x00, 0x00, 0x00},
+     {0xff, 0xbb, 0x00}, {0xff, 0xbb, 0x00}, {0x73, 0x54, 0x00}, {0x00, 0x00, 0x00},
+     {0xff, 0xbb, 0x00}, {0xff, 0xbb, 0x00}, {0x73, 0x54, 0x00}, {0x00, 0x00, 0x00}},
+    /* 95 */
+    {{0xff, 0xb7, 0x00}, {0xff, 0xb7, 0x00}, {0x79, 0x57, 0x00}, {0x00, 0x00, 0x00},
+     {0xff, 0xb7, 0x00}, {0xff, 0xb7, 0x00}, {0x79, 0x57, 0x00}, {0x00, 0x00, 0x00},
+     {0xff, 0xb7, 0x00}, {0xff, 0xb7, 0x00}, {0x79, 0x57, 0x00}, {0x00, 0x00, 0x00}},
+    /* 96 */
+    {{0xff, 0xb7, 0x00}, {0xff, 0xb7, 0x00}, {0x7f, 0x5b, 0x00}, {0x00, 0x00, 0x00},
+     {0xff, 0xb7, 0x00}, {0xff, 0xb7, 0x00}, {0x7f, 0x5b, 0x00}, {0x00, 0x00, 0x00},
+     {0xff, 0xb7, 0x00}, {0xff, 0xb7, 0x00}, {0x7f, 0x5b, 0x00}, {0x00, 0x00, 0x00}},
+    /* 97 */
+    {{0xff, 0xb7, 0x00}, {0xff, 0xb7, 0x00}, {0x8c, 0x64, 0x00}, {0x00, 0x00, 0x00},
+     {0xff, 0xb7, 0x00}, {0xff, 0xb7, 0x00}, {0x8c, 0x64, 0x00}, {0x00, 0x00, 0x00},
+     {0xff, 0xb7, 0x00}, {0xff, 0xb7, 0x00}, {0x8c, 0x64, 0x00}, {0x00, 0x00, 0x00}},
+    /* 98 */
+    {{0xff, 0xb3, 0x00}, {0xff, 0xb3, 0x00}, {0x93, 0x67, 0x00}, {0x00, 0x00, 0x00},
+     {0xff, 0xb3, 0x00}, {0xff, 0xb3, 0x00}, {0x93, 0x67, 0x00}, {0x00, 0x00, 0x00},
+     {0xff, 0xb3, 0x00}, {0xff, 0xb3, 0x00}, {0x93, 0x67, 0x00}, {0x00, 0x00, 0x00}},
+    /* 99 */
+    {{0xff, 0xb3, 0x00}, {0xff, 0xb3, 0x00}, {0x99, 0x6b, 0x00}, {0x00, 0x00, 0x00},
+     {0xff, 0xb3, 0x00}, {0xff, 0xb3, 0x00}, {0x99, 0x6b, 0x00}, {0x00, 0x00, 0x00},
+     {0xff, 0xb3, 0x00}, {0xff, 0xb3, 0x00}, {0x99, 0x6b, 0x00}, {0x00, 0x00, 0x00}},
+    /* 100 */
+    {{0xff, 0xae, 0x00}, {0xff, 0xae, 0x00}, {0x9f, 0x6d, 0x00}, {0x00, 0x00, 0x00},
+     {0xff, 0xae, 0x00}, {0xff, 0xae, 0x00}, {0x9f, 0x6d, 0x00}, {0x00, 0x00, 0x00},
+     {0xff, 0xae, 0x00}, {0xff, 0xae, 0x00}, {0x9f, 0x6d, 0x00}, {0x00, 0x00, 0x00}},
+    /* 101 */
+    {{0xff, 0xae, 0x00}, {0xff, 0xae, 0x00}, {0xa6, 0x71, 0x00}, {0x00, 0x00, 0x00},
+     {0xff, 0xae, 0x00}, {0xff, 0xae, 0x00}, {0xa6, 0x71, 0x00}, {0x00, 0x00, 0x00},
+     {0xff, 0xae, 0x00}, {0xff, 0xae, 0x00}, {0xa6, 0x71, 0x00}, {0x00, 0x00, 0x00}},
+    /* 102 */
+    {{0xff, 0xaa, 0x00}, {0xff, 0xaa, 0x00}, {0xac, 0x73, 0x00}, {0x00, 0x00, 0x00},
+     {0xff, 0xaa, 0x00}, {0xff, 0xaa, 0x00}, {0xac, 0x73, 0x00}, {0x00, 0x00, 0x00},
+     {0xff, 0xaa, 0x00}, {0xff, 0xaa, 0x00}, {0xac, 0x73, 0x00}, {0x00, 0x00, 0x00}},
+    /* 103 */
+    {{0xff, 0xaa, 0x00}, {0xff, 0xaa, 0x00}, {0xb3, 0x77, 0x00}, {0x00, 0x00, 0x00},
+     {0xff, 0xaa, 0x00}, {0xff, 0xaa, 0x00}, {0xb3, 0x77, 0x00}, {0x00, 0x00, 0x00},
+     {0xff, 0xaa, 0x00}, {0xff, 0xaa, 0x00}, {0xb3, 0x77, 0x00}, {0x00, 0x00, 0x00}},
+    /* 104 */
+    {{0xff, 0xa6, 0x00}, {0xff, 0xa6, 0x00}, {0xb9, 0x78, 0x00}, {0x00, 0x00, 0x00},
+     {0xff, 0xa6, 0x00}, {0xff, 0xa6, 0x00}, {0xb9, 0x78, 0x00}, {0x00, 0x00, 0x00},
+     {0xff, 0xa6, 0x00}, {0xff, 0xa6, 0x00}, {0xb9, 0x78, 0x00}, {0x00, 0x00, 0x00}},
+    /* 105 */
+    {{0xff, 0xa6, 0x00}, {0xff, 0xa6, 0x00}, {0xbf, 0x7c, 0x00}, {0x00, 0x00, 0x00},
+     {0xff, 0xa6, 0x00}, {0xff, 0xa6, 0x00}, {0xbf, 0x7c, 0x00}, {0x00, 0x00, 0x00},
+     {0xff, 0xa6, 0x00}, {0xff, 0xa6, 0x00}, {0xbf, 0x7c, 0x00}, {0x00, 0x00, 0x00}},
+    /* 106 */
+    {{0xff, 0xa6, 0x00}, {0xff, 0xa6, 0x00}, {0xb9, 0x78, 0x00}, {0x00, 0x00, 0x00},
+     {0xff, 0xa6, 0x00}, {0xff, 0xa6, 0x00}, {0xb9, 0x78, 0x00}, {0x00, 0x00, 0x00},
+     {0xff, 0xa6, 0x00}, {0xff, 0xa6, 0x00}, {0xb9, 0x78, 0x00}, {0x00, 0x00, 0x00}},
+    /* 107 */
+    {{0xff, 0xa6, 0x00}, {0xff, 0xa6, 0x00}, {0xb9, 0x78, 0x00}, {0x00, 0x00, 0x00},
+     {0xff, 0xa6, 0x00}, {0xff, 0xa6, 0x00}, {0xb9, 0x78, 0x00}, {0x00, 0x00, 0x00},
+     {0xff, 0xa6, 0x00}, {0xff, 0xa6, 0x00}, {0xb9, 0x78, 0x00}, {0x00, 0x00, 0x00}},
+    /* 108 */
+    {{0xff, 0xaa, 0x00}, {0xff, 0xaa, 0x00}, {0xb3, 0x77, 0x00}, {0x00, 0x00, 0x00},
+     {0xff, 0xaa, 0x00}, {0xff, 0xaa, 0x00}, {0xb3, 0x77, 0x00}, {0x00, 0x00, 0x00},
+     {0xff, 0xaa, 0x00}, {0xff, 0xaa, 0x00}, {0xb3, 0x77, 0x00}, {0x00, 0x00, 0x00}},
+    /* 109 */
+    {{0xff, 0xaa, 0x00}, {0xff, 0xaa, 0x00}, {0xac, 0x73, 0x00}, {0x00, 0x00, 0x00},
+     {0xff, 0xaa, 0x00}, {0xff, 0xaa, 0x00}, {0xac, 0x73, 0x00}, {0x00, 0x00, 0x00},
+     {0xff, 0xaa, 0x00}, {0xff, 0xaa, 0x00}, {0xac, 0x73, 0x00}, {0x00, 0x00, 0x00}},
+    /* 110 */
+    {{0xff, 0xaa, 0x00}, {0xff, 0xaa, 0x00}, {0xac, 0x73, 0x00}, {0x00, 0x00, 0x00},
+     {0xff, 0xaa, 0x00}, {0xff, 0xaa, 0x00}, {0xac, 0x73, 0x00}, {0x00, 0x00, 0x00},
+     {0xff, 0xaa, 0x00}, {0xff, 0xaa, 0x00}, {0xac, 0x73, 0x00}, {0x00, 0x00, 0x00}},
+    /* 111 */
+    {{0xff, 0xaa, 0x00}, {0xff, 0xaa, 0x00}, {0xa6, 0x6e, 0x00}, {0x00, 0x00, 0x00},
+     {0xff, 0xaa, 0x00}, {0xff, 0xaa, 0x00}, {0xa6, 0x6e, 0x00}, {0x00, 0x00, 0x00},
+     {0xff, 0xaa, 0x00}, {0xff, 0xaa, 0x00}, {0xa6, 0x6e, 0x00}, {0x00, 0x00, 0x00}},
+    /* 112 */
+    {{0xff, 0xae, 0x00}, {0xff, 0xae, 0x00}, {0xa6, 0x71, 0x00}, {0x00, 0x00, 0x00},
+     {0xff, 0xae, 0x00}, {0xff, 0xae, 0x00}, {0xa6, 0x71, 0x00}, {0x00, 0x00, 0x00},
+     {0xff, 0xae, 0x00}, {0xff, 0xae, 0x00}, {0xa6, 0x71, 0x00}, {0x00, 0x00, 0x00}},
+    /* 113 */
+    {{0xff, 0xae, 0x00}, {0xff, 0xae, 0x00}, {0x9f, 0x6d, 0x00}, {0x00, 0x00, 0x00},
+     {0xff, 0xae, 0x00}, {0xff, 0xae, 0x00}, {0x9f, 0x6d, 0x00}, {0x00, 0x00, 0x00},
+     {0xff, 0xae, 0x00}, {0xff, 0xae, 0x00}, {0x9f, 0x6d, 0x00}, {0x00, 0x00, 0x00}},
+    /* 114 */
+    {{0xff, 0xae, 0x00}, {0xff, 0xae, 0x00}, {0x9f, 0x6d, 0x00}, {0x00, 0x00, 0x00},
+     {0xff, 0xae, 0x00}, {0xff, 0xae, 0x00}, {0x9f, 0x6d, 0x00}, {0x00, 0x00, 0x00},
+     {0xff, 0xae, 0x00}, {0xff, 0xae, 0x00}, {0x9f, 0x6d, 0x00}, {0x00, 0x00, 0x00}},
+    /* 115 */
+    {{0xff, 0xae, 0x00}, {0xff, 0xae, 0x00}, {0x99, 0x68, 0x00}, {0x00, 0x00, 0x00},
+     {0xff, 0xae, 0x00}, {0xff, 0xae, 0x00}, {0x99, 0x68, 0x00}, {0x00, 0x00, 0x00},
+     {0xff, 0xae, 0x00}, {0xff, 0xae, 0x00}, {0x99, 0x68, 0x00}, {0x00, 0x00, 0x00}},
+    /* 116 */
+    {{0xff, 0xb3, 0x00}, {0xff, 0xb3, 0x00}, {0x93, 0x67, 0x00}, {0x00, 0x00, 0x00},
+     {0xff, 0xb3, 0x00}, {0xff, 0xb3, 0x00}, {0x93, 0x67, 0x00}, {0x00, 0x00, 0x00},
+     {0xff, 0xb3, 0x00}, {0xff, 0xb3, 0x00}, {0x93, 0x67, 0x00}, {0x00, 0x00, 0x00}},
+    /* 117 */
+    {{0xff, 0xb3, 0x00}, {0xff, 0xb3, 0x00}, {0x93, 0x67, 0x00}, {0x00, 0x00, 0x00},
+     {0xff, 0xb3, 0x00}, {0xff, 0xb3, 0x00}, {0x93, 0x67, 0x00}, {0x00, 0x00, 0x00},
+     {0xff, 0xb3, 0x00}, {0xff, 0xb3, 0x00}, {0x93, 0x67, 0x00}, {0x00, 0x00, 0x00}},
+    /* 118 */
+    {{0xff, 0xb3, 0x00}, {0xff, 0xb3, 0x00}, {0x8c, 0x62, 0x00}, {0x00, 0x00, 0x00},
+     {0xff, 0xb3, 0x00}, {0xff, 0xb3, 0x00}, {0x8c, 0x62, 0x00}, {0x00, 0x00, 0x00},
+     {0xff, 0xb3, 0x00}, {0xff, 0xb3, 0x00}, {0x8c, 0x62, 0x00}, {0x00, 0x00, 0x00}},
+    /* 119 */
+    {{0xff, 0xb3, 0x00}, {0xff, 0xb3, 0x00}, {0x8c, 0x62, 0x00}, {0x00, 0x00, 0x00},
+     {0xff, 0xb3, 0x00}, {0xff, 0xb3, 0x00}, {0x8c, 0x62, 0x00}, {0x00, 0x00, 0x00},
+     {0xff, 0xb3, 0x00}, {0xff, 0xb3, 0x00}, {0x8c, 0x62, 0x00}, {0x00, 0x00, 0x00}},
+    /* 120 */
+    {{0xff, 0xb7, 0x00}, {0xff, 0xb7, 0x00}, {0x7f, 0x5b, 0x00}, {0x00, 0x00, 0x00},
+     {0xff, 0xb7, 0x00}, {0xff, 0xb7, 0x00}, {0x7f, 0x5b, 0x00}, {0x00, 0x00, 0x00},
+     {0xff, 0xb7, 0x00}, {0xff, 0xb7, 0x00}, {0x7f, 0x5b, 0x00}, {0x00, 0x00, 0x00}},
+    /* 121 */
+    {{0xff, 0xbb, 0x00}, {0xff, 0xbb, 0x00}, {0x73, 0x54, 0x00}, {0x00, 0x00, 0x00},
+     {0xff, 0xbb, 0x00}, {0xff, 0xbb, 0x00}, {0x73, 0x54, 0x00}, {0x00, 0x00, 0x00},
+     {0xff, 0xbb, 0x00}, {0xff, 0xbb, 0x00}, {0x73, 0x54, 0x00}, {0x00, 0x00, 0x00}},
+    /* 122 */
+    {{0xff, 0xbf, 0x00}, {0xff, 0xbf, 0x00}, {0x66, 0x4c, 0x00}, {0x00, 0x00, 0x00},
+     {0xff, 0xbf, 0x00}, {0xff, 0xbf, 0x00}, {0x66, 0x4c, 0x00}, {0x00, 0x00, 0x00},
+     {0xff, 0xbf, 0x00}, {0xff, 0xbf, 0x00}, {0x66, 0x4c, 0x00}, {0x00, 0x00, 0x00}},
+    /* 123 */
+    {{0xff, 0xc4, 0x00}, {0xff, 0xc4, 0x00}, {0x59, 0x44, 0x00}, {0x00, 0x00, 0x00},
+     {0xff, 0xc4, 0x00}, {0xff, 0xc4, 0x00}, {0x59, 0x44, 0x00}, {0x00, 0x00, 0x00},
+     {0xff, 0xc4, 0x00}, {0xff, 0xc4, 0x00}, {0x59, 0x44, 0x00}, {0x00, 0x00, 0x00}},
+    /* 124 */
+    {{0xff, 0xc4, 0x00}, {0xff, 0xc4, 0x00}, {0x4c, 0x3a, 0x00}, {0x00, 0x00, 0x00},
+     {0xff, 0xc4, 0x00}, {0xff, 0xc4, 0x00}, {0x4c, 0x3a, 0x00}, {0x00, 0x00, 0x00},
+     {0xff, 0xc4, 0x00}, {0xff, 0xc4, 0x00}, {0x4c, 0x3a, 0x00}, {0x00, 0x00, 0x00}},
+    /* 125 */
+    {{0xff, 0xc8, 0x00}, {0xff, 0xc8, 0x00}, {0x3f, 0x32, 0x00}, {0x00, 0x00, 0x00},
+     {0xff, 0xc8, 0x00}, {0xff, 0xc8, 0x00}, {0x3f, 0x32, 0x00}, {0x00, 0x00, 0x00},
+     {0xff, 0xc8, 0x00}, {0xff, 0xc8, 0x00}, {0x3f, 0x32, 0x00}, {0x00, 0x00, 0x00}},
+    /* 126 */
+    {{0xff, 0xcc, 0x00}, {0xff, 0xcc, 0x00}, {0x33, 0x28, 0x00}, {0x00, 0x00, 0x00},
+     {0xff, 0xcc, 0x00}, {0xff, 0xcc, 0x00}, {0x33, 0x28, 0x00}, {0x00, 0x00, 0x00},
+     {0xff, 0xcc, 0x00}, {0xff, 0xcc, 0x00}, {0x33, 0x28, 0x00}, {0x00, 0x00, 0x00}},
+    /* 127 */
+    {{0xff, 0xd1, 0x00}, {0xff, 0xd1, 0x00}, {0x26, 0x1f, 0x00}, {0x00, 0x00, 0x00},
+     {0xff, 0xd1, 0x00}, {0xff, 0xd1, 0x00}, {0x26, 0x1f, 0x00}, {0x00, 0x00, 0x00},
+     {0xff, 0xd1, 0x00}, {0xff, 0xd1, 0x00}, {0x26, 0x1f, 0x00}, {0x00, 0x00, 0x00}},
+    /* 128 */
+    {{0xff, 0xd5, 0x00}, {0xff, 0xd5, 0x00}, {0x19, 0x15, 0x00}, {0x00, 0x00, 0x00},
+     {0xff, 0xd5, 0x00}, {0xff, 0xd5, 0x00}, {0x19, 0x15, 0x00}, {0x00, 0x00, 0x00},
+     {0xff, 0xd5, 0x00}, {0xff, 0xd5, 0x00}, {0x19, 0x15, 0x00}, {0x00, 0x00, 0x00}},
+    /* 129 */
+    {{0xff, 0xd9, 0x00}, {0xff, 0xd9, 0x00}, {0x0c, 0x0a, 0x00}, {0x00, 0x00, 0x00},
+     {0xff, 0xd9, 0x00}, {0xff, 0xd9, 0x00}, {0x0c, 0x0a, 0x00}, {0x00, 0x00, 0x00},
+     {0xff, 0xd9, 0x00}, {0xff, 0xd9, 0x00}, {0x0c, 0x0a, 0x00}, {0x00, 0x00, 0x00}},
+    /* 130 */
+    {{0xff, 0xdd, 0x00}, {0xff, 0xdd, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0xff, 0xdd, 0x00}, {0xff, 0xdd, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0xff, 0xdd, 0x00}, {0xff, 0xdd, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}},
+    /* 131 */
+    {{0xff, 0xe2, 0x00}, {0xff, 0xe2, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0xff, 0xe2, 0x00}, {0xff, 0xe2, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0xff, 0xe2, 0x00}, {0xff, 0xe2, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}},
+    /* 132 */
+    {{0xff, 0xe6, 0x00}, {0xff, 0xe6, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0xff, 0xe6, 0x00}, {0xff, 0xe6, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0xff, 0xe6, 0x00}, {0xff, 0xe6, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}},
+    /* 133 */
+    {{0xff, 0xe6, 0x00}, {0xff, 0xe6, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0xff, 0xe6, 0x00}, {0xff, 0xe6, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0xff, 0xe6, 0x00}, {0xff, 0xe6, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}},
+    /* 134 */
+    {{0xff, 0xea, 0x00}, {0xff, 0xea, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0xff, 0xea, 0x00}, {0xff, 0xea, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0xff, 0xea, 0x00}, {0xff, 0xea, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}},
+    /* 135 */
+    {{0xff, 0xee, 0x00}, {0xff, 0xee, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0xff, 0xee, 0x00}, {0xff, 0xee, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0xff, 0xee, 0x00}, {0xff, 0xee, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}},
+    /* 136 */
+    {{0xff, 0xf3, 0x00}, {0xff, 0xf3, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0xff, 0xf3, 0x00}, {0xff, 0xf3, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0xff, 0xf3, 0x00}, {0xff, 0xf3, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}},
+    /* 137 */
+    {{0xff, 0xf7, 0x00}, {0xff, 0xf7, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0xff, 0xf7, 0x00}, {0xff, 0xf7, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0xff, 0xf7, 0x00}, {0xff, 0xf7, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}},
+    /* 138 */
+    {{0xff, 0xfb, 0x00}, {0xff, 0xfb, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0xff, 0xfb, 0x00}, {0xff, 0xfb, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0xff, 0xfb, 0x00}, {0xff, 0xfb, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}},
+    /* 139 */
+    {{0xff, 0xff, 0x00}, {0xff, 0xff, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0xff, 0xff, 0x00}, {0xff, 0xff, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0xff, 0xff, 0x00}, {0xff, 0xff, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}},
+    /* 140 */
+    {{0xfb, 0xff, 0x00}, {0xfb, 0xff, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0xfb, 0xff, 0x00}, {0xfb, 0xff, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0xfb, 0xff, 0x00}, {0xfb, 0xff, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}},
+    /* 141 */
+    {{0xf7, 0xff, 0x00}, {0xf7, 0xff, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0xf7, 0xff, 0x00}, {0xf7, 0xff, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0xf7, 0xff, 0x00}, {0xf7, 0xff, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}},
+    /* 142 */
+    {{0xf3, 0xff, 0x00}, {0xf3, 0xff, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0xf3, 0xff, 0x00}, {0xf3, 0xff, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0xf3, 0xff, 0x00}, {0xf3, 0xff, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}},
+    /* 143 */
+    {{0xee, 0xff, 0x00}, {0xee, 0xff, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0xee, 0xff, 0x00}, {0xee, 0xff, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0xee, 0xff, 0x00}, {0xee, 0xff, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}},
+    /* 144 */
+    {{0xea, 0xff, 0x00}, {0xea, 0xff, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0xea, 0xff, 0x00}, {0xea, 0xff, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0xea, 0xff, 0x00}, {0xea, 0xff, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}},
+    /* 145 */
+    {{0xe6, 0xff, 0x00}, {0xe6, 0xff, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0xe6, 0xff, 0x00}, {0xe6, 0xff, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0xe6, 0xff, 0x00}, {0xe6, 0xff, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}},
+    /* 146 */
+    {{0xe2, 0xff, 0x00}, {0xe2, 0xff, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0xe2, 0xff, 0x00}, {0xe2, 0xff, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0xe2, 0xff, 0x00}, {0xe2, 0xff, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}},
+    /* 147 */
+    {{0xdd, 0xff, 0x00}, {0xdd, 0xff, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0xdd, 0xff, 0x00}, {0xdd, 0xff, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0xdd, 0xff, 0x00}, {0xdd, 0xff, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}},
+    /* 148 */
+    {{0xd9, 0xff, 0x00}, {0xd9, 0xff, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0xd9, 0xff, 0x00}, {0xd9, 0xff, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0xd9, 0xff, 0x00}, {0xd9, 0xff, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}},
+    /* 149 */
+    {{0xd5, 0xff, 0x00}, {0xca, 0xf3, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0xd5, 0xff, 0x00}, {0xca, 0xf3, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00},
+     {0xd5, 0xff, 0x00}, {0xca, 0xf3, 0x00}, {0x00, 0x00, 0x00}, {0x00, 0x00, 0x00}},
+};
@@ -0,0 +1,210 @@
+/*
+ * Copyright (c) 2024 Kuba Birecki
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <stdlib.h>
+#include <string.h>
+
+#include <zephyr/device.h>
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+
+#include <drivers/rgb_fx.h>
+
+#include <zmk/rgb_fx.h>
+#include <zmk/event_manager.h>
+#include <zmk/events/position_state_changed.h>
+
+#define SCENARIO_NODE DT_NODELABEL(scenario)
+
+#define FRAME_PERIOD_MS (1000 / CONFIG_ZMK_RGB_FX_FPS)
+
+/**
+ * Keys are tapped half a frame before a frame is rendered, so neither the taps nor the timers
+ * they start ever coincide with a frame.
+ */
+#define TAP_OFFSET_MS (FRAME_PERIOD_MS / 2)
+
+/**
+ * Every scenario renders its effect for a number of frames, tapping the given keys at a fixed
+ * interval from the start. The budget is the largest number of pixel operations a single frame
+ * may take, set about a quarter above the most the scenario was recorded with. Effects are
+ * advanced by the start offset without rendering before the first frame.
+ */
+#if DT_NODE_EXISTS(DT_NODELABEL(linear_gradient_offset))
+#define GOLDEN_FRAMES "golden/linear_gradient_offset.h"
+
+#define NUM_FRAMES 75
+#define OPS_BUDGET 45
+#define START_OFFSET_MS 700
+#define TAP_INTERVAL_MS 0
+
+static const uint32_t taps[] = {};
+#elif DT_NODE_HAS_COMPAT(SCENARIO_NODE, zmk_rgb_fx_sparkle)
+#define GOLDEN_FRAMES "golden/sparkle.h"
+
+#define NUM_FRAMES 100
+#define OPS_BUDGET 58
+#define TAP_INTERVAL_MS 0
+
+static const uint32_t taps[] = {};
+#elif DT_NODE_HAS_COMPAT(SCENARIO_NODE, zmk_rgb_fx_ripple)
+#define GOLDEN_FRAMES "golden/ripple.h"
+
+#define NUM_FRAMES 60
+#define OPS_BUDGET 74
+#define TAP_INTERVAL_MS 200
+
+// Overlapping ripples from the middle of the grid, a corner and the opposite corner.
+static const uint32_t taps[] = {5, 0, 11};
+#elif DT_NODE_HAS_COMPAT(SCENARIO_NODE, zmk_rgb_fx_wpm)
+#define GOLDEN_FRAMES "golden/wpm.h"
+
+#define NUM_FRAMES 150
+#define OPS_BUDGET 36
+#define TAP_INTERVAL_MS 160
+
+// Typing at 75 WPM for two seconds, after which the indicator falls back down.
+static const uint32_t taps[] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 0};
+#elif DT_NODE_HAS_COMPAT(SCENARIO_NODE, zmk_rgb_fx_linear_gradient)
+#define GOLDEN_FRAMES "golden/linear_gradient.h"
+
+#define NUM_FRAMES 50
+#define OPS_BUDGET 60
+#define TAP_INTERVAL_MS 0
+
+static const uint32_t taps[] = {};
+#else
+#error "The scenario overlay must define an effect labeled scenario"
+#endif
+
+#ifndef START_OFFSET_MS
+#define START_OFFSET_MS 0
+#endif
+
+#if !IS_ENABLED(CONFIG_RGB_FX_GOLDEN_RECORD)
+#include GOLDEN_FRAMES
+#endif
+
+static const struct device *fx = DEVICE_DT_GET(SCENARIO_NODE);
+
+/**
+ * The scenario is rendered into its own frame, while the chosen root effect is left to
+ * the animation timer.
+ */
+RGB_FX_FRAME_DEFINE(frame, colors);
+
+static int raise_key(uint32_t position, bool pressed) {
+    return raise_zmk_position_state_changed((struct zmk_position_state_changed){
+        .source = ZMK_POSITION_STATE_CHANGE_SOURCE_LOCAL,
+        .position = position,
+        .state = pressed,
+        .timestamp = k_uptime_get(),
+    });
+}
+
+/**
+ * Renders the next frame of the scenario and converts it for the LED drivers,
+ * like the animation tick does. Returns the number of pixel operations it took.
+ */
+static uint32_t render_frame(struct led_rgb *pixels) {
+    const uint32_t start = zmk_rgb_fx_get_op_count();
+
+    rgb_fx_render_frame(fx, &frame, FRAME_PERIOD_MS);
+    zmk_rgb_to_led_rgb_span(colors, pixels, RGB_FX_NUM_PIXELS);
+
+    const uint32_t ops = zmk_rgb_fx_get_op_count() - start;
+
+    memset(colors, 0, sizeof(colors));
+
+    return ops;
+}
+
+#if IS_ENABLED(CONFIG_RGB_FX_GOLDEN_RECORD)
+/**
+ * Prints the frame in the format of the golden headers, one row of the grid per line.
+ */
+static void print_frame(size_t i, const struct led_rgb *pixels) {
+    printk("    /* %u */\n    {", (unsigned int)i);
+
+    for (size_t px = 0; px < RGB_FX_NUM_PIXELS; ++px) {
+        printk("%s{0x%02x, 0x%02x, 0x%02x}%s", px > 0 && px % 4 == 0 ? "     " : "",
+               pixels[px].r, pixels[px].g, pixels[px].b,
+               px == RGB_FX_NUM_PIXELS - 1 ? "},\n" : (px % 4 == 3 ? ",\n" : ", "));
+    }
+}
+#else
+static void assert_frame_equal(size_t i, const struct led_rgb *pixels) {
+    for (size_t px = 0; px < RGB_FX_NUM_PIXELS; ++px) {
+        const uint8_t *expected = golden_frames[i][px];
+
+        zassert_true(abs(pixels[px].r - expected[0]) <= CONFIG_RGB_FX_GOLDEN_TOLERANCE &&
+                         abs(pixels[px].g - expected[1]) <= CONFIG_RGB_FX_GOLDEN_TOLERANCE &&
+                         abs(pixels[px].b - expected[2]) <= CONFIG_RGB_FX_GOLDEN_TOLERANCE,
+                     "frame %u: pixel %u is %02x %02x %02x instead of %02x %02x %02x",
+                     (unsigned int)i, (unsigned int)px, pixels[px].r, pixels[px].g, pixels[px].b,
+                     expected[0], expected[1], expected[2]);
+    }
+}
+#endif
+
+ZTEST(rgb_fx_golden, test_frames) {
+    struct led_rgb pixels[RGB_FX_NUM_PIXELS];
+    uint32_t max_ops = 0;
+    size_t next_tap = 0;
+
+#if !IS_ENABLED(CONFIG_RGB_FX_GOLDEN_RECORD)
+    zassert_equal(ARRAY_SIZE(golden_frames), NUM_FRAMES, "the golden frames are out of date");
+#endif
+
+    rgb_fx_start(fx);
+
+    if (START_OFFSET_MS > 0) {
+        rgb_fx_skip_frame(fx, START_OFFSET_MS);
+    }
+
+    const int64_t start = k_uptime_get();
+
+#if IS_ENABLED(CONFIG_RGB_FX_GOLDEN_RECORD)
+    printk("static const uint8_t golden_frames[][RGB_FX_NUM_PIXELS][3] = {\n");
+#endif
+
+    for (size_t i = 0; i < NUM_FRAMES; ++i) {
+        const int64_t frame_time = start + (i + 1) * FRAME_PERIOD_MS;
+
+        for (; next_tap < ARRAY_SIZE(taps) &&
+               start + TAP_OFFSET_MS + next_tap * TAP_INTERVAL_MS < frame_time;
+             ++next_tap) {
+            k_sleep(K_TIMEOUT_ABS_MS(start + TAP_OFFSET_MS + next_tap * TAP_INTERVAL_MS));
+
+            zassert_ok(raise_key(taps[next_tap], true), "tap %u was dropped",
+                       (unsigned int)next_tap);
+            zassert_ok(raise_key(taps[next_tap], false));
+        }
+
+        k_sleep(K_TIMEOUT_ABS_MS(frame_time));
+
+        const uint32_t ops = render_frame(pixels);
+
+        max_ops = MAX(max_ops, ops);
+
+#if IS_ENABLED(CONFIG_RGB_FX_GOLDEN_RECORD)
+        print_frame(i, pixels);
+#else
+        assert_frame_equal(i, pixels);
+
+        zassert_true(ops <= OPS_BUDGET, "frame %u took %u operations, over the budget of %u",
+                     (unsigned int)i, ops, OPS_BUDGET);
+#endif
+    }
+
+#if IS_ENABLED(CONFIG_RGB_FX_GOLDEN_RECORD)
+    printk("};\n");
+#endif
+
+    TC_PRINT("max %u operations per frame, budget %u\n", max_ops, OPS_BUDGET);
+}
+
+ZTEST_SUITE(rgb_fx_golden, NULL, NULL, NULL, NULL, NULL);
@@ -0,0 +1,377 @@
+/*
+ * Copyright (c) 2024 Kuba Birecki
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <zephyr/device.h>
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+
+#include <zmk/led_strip_emul.h>
+#include <zmk/rgb_fx.h>
+#include <zmk/event_manager.h>
+#include <zmk/events/position_state_changed.h>
+
+#define RIPPLE_NODE DT_NODELABEL(ripple)
+#define STRIP_NODE DT_NODELABEL(rgb_fx_strip)
+
+#define RIPPLE_BUFFER_SIZE DT_PROP(RIPPLE_NODE, buffer_size)
+#define RIPPLE_DURATION_MS DT_PROP(RIPPLE_NODE, duration)
+#define NUM_PIXELS DT_PROP(STRIP_NODE, chain_length)
+#define FRAME_PERIOD_MS (1000 / CONFIG_ZMK_RGB_FX_FPS)
+
+/**
+ * A ripple is retired by the first frame after it has been rendered at its full distance,
+ * which is between its duration and two frame periods later than the key press.
+ */
+#define RIPPLE_MIN_LIFETIME_MS RIPPLE_DURATION_MS
+#define RIPPLE_MAX_LIFETIME_MS (RIPPLE_DURATION_MS + 2 * FRAME_PERIOD_MS)
+
+/**
+ * Keys are pressed from a timer interrupt at random intervals, in floods of random length.
+ * The emulated strip blocks the work queue for the bus time, so many of the interrupts land
+ * in the middle of a frame. Keys are also pressed from inside the ripple's render, through the
+ * pixel distance lookup, in between the ripple taking the pending events and retiring them.
+ */
+#define NUM_FLOODS 50
+#define MAX_FLOOD_MS 200
+#define MAX_PRESS_INTERVAL_MS 7
+#define RENDER_PRESS_CHANCE 8
+#define MAX_PRESSES 4096
+
+static const struct device *strip = DEVICE_DT_GET(STRIP_NODE);
+
+struct press {
+    int64_t uptime;
+    uint32_t position;
+    int ret;
+};
+
+/**
+ * Every press made during the floods, in the order they were made.
+ */
+static struct press presses[MAX_PRESSES];
+static size_t num_presses;
+
+/**
+ * Number of presses made while a frame was being rendered or sent to the strip.
+ */
+static size_t num_render_presses;
+static size_t num_interrupting_presses;
+
+static atomic_t flooding = ATOMIC_INIT(false);
+
+/**
+ * Shared by the test, the render and the timer, so it's only used with interrupts locked
+ * while a flood is running.
+ */
+static uint32_t rng_state;
+
+static uint32_t next_random(void) {
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 17;
+    rng_state ^= rng_state << 5;
+
+    return rng_state;
+}
+
+static int raise_key(uint32_t position, bool pressed) {
+    return raise_zmk_position_state_changed((struct zmk_position_state_changed){
+        .source = ZMK_POSITION_STATE_CHANGE_SOURCE_LOCAL,
+        .position = position,
+        .state = pressed,
+        .timestamp = k_uptime_get(),
+    });
+}
+
+/**
+ * Presses and releases a key, returning the result of the press. Releases are ignored by the
+ * ripple, so their result is only returned if it isn't 0.
+ */
+static int tap_key(uint32_t position) {
+    const int ret = raise_key(position, true);
+    const int release_ret = raise_key(position, false);
+
+    return release_ret != 0 ? release_ret : ret;
+}
+
+/**
+ * Presses a random key and records the result. Interrupts are locked, so presses made from
+ * the render and from the timer are recorded in the order they were made.
+ */
+static void flood_press(void) {
+    const unsigned int key = irq_lock();
+
+    if (num_presses < ARRAY_SIZE(presses)) {
+        const uint32_t position = next_random() % NUM_PIXELS;
+
+        presses[num_presses++] = (struct press){
+            .uptime = k_uptime_get(),
+            .position = position,
+            .ret = tap_key(position),
+        };
+    }
+
+    irq_unlock(key);
+}
+
+static void flood_timer_handler(struct k_timer *timer) {
+    if (k_current_get() == &zmk_rgb_fx_work_q()->thread) {
+        num_interrupting_presses++;
+    }
+
+    flood_press();
+
+    k_timer_start(timer, K_MSEC(1 + next_random() % MAX_PRESS_INTERVAL_MS), K_NO_WAIT);
+}
+
+K_TIMER_DEFINE(flood_timer, flood_timer_handler, NULL);
+
+uint8_t __real_zmk_rgb_fx_get_pixel_distance(size_t pixel_idx, size_t other_pixel_idx);
+
+/**
+ * The ripple looks up pixel distances only while it renders, which makes the lookup a hook
+ * for pressing keys halfway through a frame. The wrapper is set up with the linker.
+ */
+uint8_t __wrap_zmk_rgb_fx_get_pixel_distance(size_t pixel_idx, size_t other_pixel_idx) {
+    if (atomic_get(&flooding)) {
+        const unsigned int key = irq_lock();
+
+        if (next_random() % RENDER_PRESS_CHANCE == 0) {
+            num_render_presses++;
+            flood_press();
+        }
+
+        irq_unlock(key);
+    }
+
+    return __real_zmk_rgb_fx_get_pixel_distance(pixel_idx, other_pixel_idx);
+}
+
+/**
+ * Copies the pixels of the oldest strip update made at or after the given uptime.
+ */
+static void get_frame_since(int64_t since_ms, struct led_rgb *pixels) {
+    struct zmk_led_strip_emul_frame frame;
+    int found = -ENOENT;
+
+    for (size_t age = 0;
+         zmk_led_strip_emul_get_frame(strip, age, &frame, NULL, 0) == 0 &&
+         frame.timestamp_ns >= (uint64_t)since_ms * NSEC_PER_MSEC;
+         ++age) {
+        found = zmk_led_strip_emul_get_frame(strip, age, &frame, pixels, NUM_PIXELS);
+    }
+
+    zassert_ok(found, "no frame was rendered since %d ms", (int)since_ms);
+}
+
+static void assert_frame_black(void) {
+    struct led_rgb pixels[NUM_PIXELS];
+    struct zmk_led_strip_emul_frame frame;
+
+    zassert_ok(zmk_led_strip_emul_get_frame(strip, 0, &frame, pixels, NUM_PIXELS));
+
+    for (size_t i = 0; i < NUM_PIXELS; ++i) {
+        zassert_true(pixels[i].r == 0 && pixels[i].g == 0 && pixels[i].b == 0,
+                     "pixel %u is still lit", (unsigned int)i);
+    }
+}
+
+/**
+ * Waits until every ripple has finished and the animation went idle.
+ */
+static void wait_for_idle(void) {
+    k_sleep(K_MSEC(RIPPLE_MAX_LIFETIME_MS + 2 * FRAME_PERIOD_MS));
+}
+
+static void ripple_before(void *fixture) {
+    wait_for_idle();
+
+    num_presses = 0;
+    zmk_led_strip_emul_reset(strip);
+}
+
+ZTEST(rgb_fx_ripple, test_full_buffer_drops_new_presses) {
+    struct led_rgb pixels[NUM_PIXELS];
+    const int64_t start = k_uptime_get();
+
+    for (uint32_t i = 0; i < RIPPLE_BUFFER_SIZE; ++i) {
+        zassert_ok(tap_key(i), "press %u should fit into the buffer", i);
+    }
+
+    zassert_equal(tap_key(RIPPLE_BUFFER_SIZE), -ENOMEM, "the buffer should be full");
+    zassert_equal(tap_key(RIPPLE_BUFFER_SIZE + 1), -ENOMEM, "the buffer should be full");
+
+    k_sleep(K_MSEC(FRAME_PERIOD_MS + 1));
+
+    get_frame_since(start, pixels);
+
+    // The accepted ripples start at their keys, while the dropped ones don't show up at all.
+    for (size_t i = 0; i < NUM_PIXELS; ++i) {
+        const uint8_t r = i < RIPPLE_BUFFER_SIZE ? UINT8_MAX : 0;
+
+        zassert_true(pixels[i].r == r && pixels[i].g == 0 && pixels[i].b == 0,
+                     "pixel %u is %02x %02x %02x", (unsigned int)i, pixels[i].r, pixels[i].g,
+                     pixels[i].b);
+    }
+
+    // Once the ripples finish, the buffer has room for as many presses as before.
+    wait_for_idle();
+    assert_frame_black();
+
+    for (uint32_t i = 0; i < RIPPLE_BUFFER_SIZE; ++i) {
+        zassert_ok(tap_key(NUM_PIXELS - 1 - i), "press %u should fit into the buffer", i);
+    }
+
+    zassert_equal(tap_key(0), -ENOMEM, "the buffer should be full");
+}
+
+/**
+ * Checks that a press was only accepted if the buffer could have had room for it and only
+ * dropped if the buffer could have been full, from the presses accepted before it.
+ */
+static void assert_press_accounted(size_t i) {
+    const struct press *press = &presses[i];
+
+    // Presses which are certainly still in the buffer, and those which might still be.
+    size_t pending_min = 0;
+    size_t pending_max = 0;
+
+    for (size_t j = i; j-- > 0 && presses[j].uptime >= press->uptime - RIPPLE_MAX_LIFETIME_MS;) {
+        if (presses[j].ret != 0) {
+            continue;
+        }
+
+        pending_max++;
+
+        if (presses[j].uptime > press->uptime - RIPPLE_MIN_LIFETIME_MS) {
+            pending_min++;
+        }
+    }
+
+    if (press->ret == 0) {
+        zassert_true(pending_min < RIPPLE_BUFFER_SIZE,
+                     "press %u: accepted while %u were pending", (unsigned int)i,
+                     (unsigned int)pending_min);
+    } else {
+        zassert_equal(press->ret, -ENOMEM, "press %u: unexpected error %d", (unsigned int)i,
+                      press->ret);
+        zassert_true(pending_max >= RIPPLE_BUFFER_SIZE,
+                     "press %u: dropped while at most %u were pending", (unsigned int)i,
+                     (unsigned int)pending_max);
+    }
+}
+
+/**
+ * Checks that the ripple of an accepted press started at full color at its key, in one of
+ * the frames sent within two frame periods of it.
+ */
+static void assert_ripple_shown(size_t i) {
+    const struct press *press = &presses[i];
+
+    struct led_rgb pixels[NUM_PIXELS];
+    struct zmk_led_strip_emul_frame frame;
+
+    for (size_t age = 0; zmk_led_strip_emul_get_frame(strip, age, &frame, pixels, NUM_PIXELS) == 0;
+         ++age) {
+        const int64_t frame_ms = frame.timestamp_ns / NSEC_PER_MSEC;
+
+        if (frame_ms < press->uptime) {
+            break;
+        }
+
+        if (frame_ms <= press->uptime + 2 * FRAME_PERIOD_MS &&
+            pixels[press->position].r == UINT8_MAX) {
+            return;
+        }
+    }
+
+    zassert_unreachable("press %u: the ripple of key %u at %d ms is missing", (unsigned int)i,
+                        press->position, (int)press->uptime);
+}
+
+/**
+ * Checks that every frame sent since the given uptime is made of shades of the ripple color.
+ */
+static void assert_frames_intact(int64_t since_ms) {
+    struct led_rgb pixels[NUM_PIXELS];
+    struct zmk_led_strip_emul_frame frame;
+
+    for (size_t age = 0;
+         zmk_led_strip_emul_get_frame(strip, age, &frame, pixels, NUM_PIXELS) == 0 &&
+         frame.timestamp_ns >= (uint64_t)since_ms * NSEC_PER_MSEC;
+         ++age) {
+        for (size_t i = 0; i < NUM_PIXELS; ++i) {
+            zassert_true(pixels[i].g == 0 && pixels[i].b == 0,
+                         "pixel %u isn't a shade of the ripple color in the frame at %d ms",
+                         (unsigned int)i, (int)(frame.timestamp_ns / NSEC_PER_MSEC));
+        }
+    }
+}
+
+ZTEST(rgb_fx_ripple, test_floods_while_rendering) {
+    struct zmk_led_strip_emul_stats stats;
+    size_t num_accepted = 0;
+
+    rng_state = 0x2545F491;
+    num_render_presses = 0;
+    num_interrupting_presses = 0;
+
+    for (size_t flood = 0; flood < NUM_FLOODS; ++flood) {
+        const int64_t start = k_uptime_get();
+        const size_t first_press = num_presses;
+        const uint32_t flood_ms = 1 + next_random() % MAX_FLOOD_MS;
+
+        atomic_set(&flooding, true);
+        k_timer_start(&flood_timer, K_MSEC(1 + next_random() % MAX_PRESS_INTERVAL_MS), K_NO_WAIT);
+
+        k_sleep(K_MSEC(flood_ms));
+
+        k_timer_stop(&flood_timer);
+        atomic_set(&flooding, false);
+
+        // Every accepted press is shown by the time the next frame has been rendered.
+        k_sleep(K_MSEC(2 * FRAME_PERIOD_MS + 1));
+
+        zassert_true(num_presses < ARRAY_SIZE(presses), "too many presses to record");
+
+        for (size_t i = first_press; i < num_presses; ++i) {
+            assert_press_accounted(i);
+
+            if (presses[i].ret == 0) {
+                assert_ripple_shown(i);
+                num_accepted++;
+            }
+        }
+
+        assert_frames_intact(start);
+
+        k_sleep(K_MSEC(next_random() % RIPPLE_DURATION_MS));
+    }
+
+    TC_PRINT("%u presses, %u accepted, %u made while rendering, %u interrupting a frame\n",
+             (unsigned int)num_presses, (unsigned int)num_accepted,
+             (unsigned int)num_render_presses, (unsigned int)num_interrupting_presses);
+
+    zassert_true(num_render_presses > 0, "no key was pressed while rendering");
+    zassert_true(num_interrupting_presses > 0, "no key press interrupted a frame");
+
+    // Every ripple finishes and nothing is left behind in the buffer to keep the animation going.
+    wait_for_idle();
+    assert_frame_black();
+
+    zmk_led_strip_emul_get_stats(strip, &stats);
+    const uint32_t updates = stats.updates;
+
+    k_sleep(K_MSEC(10 * FRAME_PERIOD_MS));
+
+    zmk_led_strip_emul_get_stats(strip, &stats);
+    zassert_equal(stats.updates, updates, "the animation kept running after the last ripple");
+
+    for (uint32_t i = 0; i < RIPPLE_BUFFER_SIZE; ++i) {
+        zassert_ok(tap_key(i), "press %u should fit into the buffer", i);
+    }
+}
+
+ZTEST_SUITE(rgb_fx_ripple, NULL, NULL, ripple_before, NULL, NULL);